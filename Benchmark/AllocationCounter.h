@@ -0,0 +1,6 @@
+#pragma once
+#include <cstdint>
+
+// number of heap allocations of the process so far
+// bench_main.cpp replaces the global operator new to count them, so benchmarks can show allocations per iteration
+uint64_t heapAllocations();
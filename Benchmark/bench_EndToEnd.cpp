@@ -0,0 +1,81 @@
+#include <cstdint>
+
+#include "benchmark/benchmark.h"
+
+#include "AllocationCounter.h"
+#include "Generator.h"
+#include "MessageBuilder.h"
+
+// one full tick as PosGen runs it, without the socket: move, snapshot with noise, serialize
+void BM_Tick(benchmark::State& state)
+{
+	using namespace PositionGenerator;
+	const int numSensors = static_cast<int>(state.range(0));
+	Generator Gen(GenerationParameter().setNumOfSensors(numSensors).setRandomPolicy(RandomPolicy::CounterBased));
+	PublishFormat Format;
+	Format.format = static_cast<WireFormat>(state.range(1));
+	BufferPool Pool(2, tickBufferSize(Format, numSensors));
+	MessageBuilder Builder(Pool, Format);
+	TickSnapshot Snapshot;
+	TickFrames Frames;
+
+	timestamp_t timestamp = 0;
+	std::size_t bytes = 0;
+	// warm up, afterwards a tick should not touch the heap
+	Gen.generateData(timestamp);
+	Gen.captureSnapshot(Snapshot);
+	Builder.buildTick(Snapshot, Frames);
+	Frames.pBuffer->release();
+	const uint64_t allocationsBefore = heapAllocations();
+	for (auto _ : state)
+	{
+		timestamp += 40000;
+		Gen.generateData(timestamp);
+		Gen.captureSnapshot(Snapshot);
+		Builder.buildTick(Snapshot, Frames);
+		bytes += Frames.pBuffer->size();
+		Frames.pBuffer->release();
+		Frames.pBuffer = nullptr;
+	}
+	// before adding the counters, their map nodes are allocations too
+	const uint64_t allocations = heapAllocations() - allocationsBefore;
+	state.counters["ticks"] = benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+	state.counters["allocs/tick"] = static_cast<double>(allocations) / static_cast<double>(state.iterations());
+	state.SetItemsProcessed(state.iterations() * numSensors);
+	state.SetBytesProcessed(bytes);
+	state.SetLabel(wireFormatName(Format.format));
+}
+BENCHMARK(BM_Tick)
+	->ArgsProduct({ { 10, 1000, 100000 }, { static_cast<int64_t>(PositionGenerator::WireFormat::Single), static_cast<int64_t>(PositionGenerator::WireFormat::Batch), static_cast<int64_t>(PositionGenerator::WireFormat::Delta) } })
+	->Unit(benchmark::kMicrosecond);
+
+// readers of the latest snapshot while thread 0 keeps publishing, acquire and release are one atomic add each
+void BM_SharedSnapshotRead(benchmark::State& state)
+{
+	using namespace PositionGenerator;
+	static SharedSnapshot* pShared = nullptr;
+	if (state.thread_index() == 0)
+	{
+		pShared = new SharedSnapshot();
+		pShared->writeBuffer()->resize(1000);
+		pShared->publish();
+	}
+	uint64_t epochs = 0;
+	for (auto _ : state)
+	{
+		if (state.thread_index() == 0 && pShared->writeBuffer())
+			pShared->publish();
+		auto Snapshot = pShared->acquire();
+		epochs += Snapshot.epoch();
+		benchmark::DoNotOptimize(Snapshot->x[0]);
+	}
+	benchmark::DoNotOptimize(epochs);
+	state.SetItemsProcessed(state.iterations());
+	if (state.thread_index() == 0)
+	{
+		state.counters["skipped"] = static_cast<double>(pShared->numSkipped());
+		delete pShared;
+		pShared = nullptr;
+	}
+}
+BENCHMARK(BM_SharedSnapshotRead)->ThreadRange(1, 4)->UseRealTime();
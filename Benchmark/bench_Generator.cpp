@@ -0,0 +1,216 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "AllocationCounter.h"
+#include "Generator.h"
+
+namespace
+{
+	PositionGenerator::GenerationParameter benchParameter(int numSensors, PositionGenerator::RandomPolicy policy)
+	{
+		using namespace PositionGenerator;
+		return GenerationParameter()
+			.setNumOfSensors(numSensors)
+			.setBoundingCuboid(Vector3(0.f, 0.f, 0.2f), Vector3(100.f, 100.f, 1.5f))
+			.setRandomPolicy(policy);
+	}
+
+	constexpr PositionGenerator::timestamp_t TickDuration = 40000; // 25Hz in usec
+}
+
+template <PositionGenerator::RandomPolicy Policy>
+void BM_GenerateData(benchmark::State& state)
+{
+	using namespace PositionGenerator;
+	Generator Gen(benchParameter(static_cast<int>(state.range(0)), Policy));
+	timestamp_t timestamp = 0;
+	for (auto _ : state)
+	{
+		timestamp += TickDuration;
+		Gen.generateData(timestamp);
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	state.SetLabel(simdLevelName(Gen.simdLevel()));
+}
+BENCHMARK_TEMPLATE(BM_GenerateData, PositionGenerator::RandomPolicy::MersenneTwister)
+	->RangeMultiplier(10)->Range(10, 10000000)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_GenerateData, PositionGenerator::RandomPolicy::CounterBased)
+	->RangeMultiplier(10)->Range(10, 10000000)->Unit(benchmark::kMicrosecond);
+
+// large populations on one thread, range(1) selects the memory policy of the sensor columns
+void BM_GenerateDataMemoryPolicy(benchmark::State& state)
+{
+	using namespace PositionGenerator;
+	const auto policy = static_cast<MemoryPolicy>(state.range(1));
+	Generator Gen(benchParameter(static_cast<int>(state.range(0)), RandomPolicy::CounterBased)
+		.setMemoryPolicy(policy));
+	timestamp_t timestamp = 0;
+	for (auto _ : state)
+	{
+		timestamp += TickDuration;
+		Gen.generateData(timestamp);
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	state.SetLabel(std::string(policy == MemoryPolicy::HugePages ? "huge pages " : "heap ") + simdLevelName(Gen.simdLevel()));
+}
+BENCHMARK(BM_GenerateDataMemoryPolicy)
+	->ArgsProduct({ { 100000, 1000000, 10000000 }, { static_cast<int64_t>(PositionGenerator::MemoryPolicy::Default), static_cast<int64_t>(PositionGenerator::MemoryPolicy::HugePages) } })
+	->Unit(benchmark::kMicrosecond);
+
+// 90% of the sensors at 10Hz, 10% at 200Hz, ticks at 200Hz
+void BM_GenerateDataMixedRates(benchmark::State& state)
+{
+	using namespace PositionGenerator;
+	std::vector<double> Rates(10, 10.);
+	Rates.back() = 200.;
+	Generator Gen(benchParameter(static_cast<int>(state.range(0)), RandomPolicy::CounterBased).setUpdateRates(Rates));
+	constexpr timestamp_t tick = 5000;
+	timestamp_t timestamp = 0;
+	std::size_t updated = 0;
+	for (auto _ : state)
+	{
+		timestamp += tick;
+		Gen.generateData(timestamp);
+		updated += Gen.updatedSensors().size();
+		benchmark::ClobberMemory();
+	}
+	state.counters["due/tick"] = static_cast<double>(updated) / static_cast<double>(state.iterations());
+	state.SetItemsProcessed(static_cast<int64_t>(updated));
+	state.SetLabel(simdLevelName(Gen.simdLevel()));
+}
+BENCHMARK(BM_GenerateDataMixedRates)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMicrosecond);
+
+// dead reckoning between ticks, e.g. a consumer sampling at 1kHz while the generator runs at 25Hz
+void BM_EstimatePositions(benchmark::State& state)
+{
+	using namespace PositionGenerator;
+	const int numSensors = static_cast<int>(state.range(0));
+	Generator Gen(benchParameter(numSensors, RandomPolicy::CounterBased));
+	Gen.generateData(TickDuration);
+	TickSnapshot Estimate;
+	Estimate.resize(numSensors);
+	timestamp_t timestamp = TickDuration;
+	for (auto _ : state)
+	{
+		timestamp = timestamp < 2 * TickDuration ? timestamp + 1000 : TickDuration;
+		Gen.estimatePositions(0, numSensors, timestamp, Estimate.columns());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * numSensors);
+}
+BENCHMARK(BM_EstimatePositions)->RangeMultiplier(100)->Range(100, 1000000)->Unit(benchmark::kMicrosecond);
+
+// people entering and leaving: 1% of the sensors replaced every tick, with capacity reserved up front
+void BM_SensorChurn(benchmark::State& state)
+{
+	using namespace PositionGenerator;
+	const int numSensors = static_cast<int>(state.range(0));
+	const int churn = std::max(1, numSensors / 100);
+	Generator Gen(benchParameter(numSensors, RandomPolicy::CounterBased).setSensorCapacity(numSensors + churn));
+	timestamp_t timestamp = 0;
+	uint32_t next = 1;
+	auto churnSensors = [&]
+		{
+			for (int i = 0; i < churn; ++i)
+			{
+				next = next * 1664525u + 1013904223u;
+				Gen.removeSensor(Gen.sensors().at(next % Gen.sensors().size()).sensorId());
+				Gen.addSensor();
+			}
+		};
+	churnSensors();
+	const uint64_t allocationsBefore = heapAllocations();
+	for (auto _ : state)
+	{
+		timestamp += TickDuration;
+		churnSensors();
+		Gen.generateData(timestamp);
+		benchmark::ClobberMemory();
+	}
+	const uint64_t allocations = heapAllocations() - allocationsBefore;
+	state.counters["allocs/tick"] = static_cast<double>(allocations) / static_cast<double>(state.iterations());
+	state.SetItemsProcessed(state.iterations() * churn);
+}
+BENCHMARK(BM_SensorChurn)->RangeMultiplier(100)->Range(1000, 1000000)->Unit(benchmark::kMicrosecond);
+
+void BM_AddNoise(benchmark::State& state)
+{
+	using namespace PositionGenerator;
+	Generator Gen(benchParameter(10, RandomPolicy::MersenneTwister));
+	Vector3 Pos(50.f, 50.f, 1.f);
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(Gen.addNoise(Pos));
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AddNoise);
+
+void BM_AddNoiseSensor(benchmark::State& state)
+{
+	using namespace PositionGenerator;
+	Generator Gen(benchParameter(1000, RandomPolicy::CounterBased));
+	Gen.generateData(TickDuration);
+	std::vector<SensorPosition> Sensors(Gen.begin(), Gen.end());
+	for (auto _ : state)
+	{
+		for (const auto& Sensor : Sensors)
+			benchmark::DoNotOptimize(Gen.addNoise(Sensor));
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(Sensors.size()));
+}
+BENCHMARK(BM_AddNoiseSensor);
+
+template <PositionGenerator::RandomPolicy Policy>
+void BM_AddNoiseBatch(benchmark::State& state)
+{
+	using namespace PositionGenerator;
+	Generator Gen(benchParameter(10, Policy));
+	std::vector<Vector3> Positions(static_cast<std::size_t>(state.range(0)), Vector3(50.f, 50.f, 1.f));
+	std::vector<Vector3> Noisy(Positions.size());
+	for (auto _ : state)
+	{
+		Gen.addNoise(Positions, Noisy);
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_AddNoiseBatch, PositionGenerator::RandomPolicy::MersenneTwister)->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_AddNoiseBatch, PositionGenerator::RandomPolicy::CounterBased)->Arg(1000)->Arg(100000);
+
+void BM_CaptureSnapshot(benchmark::State& state)
+{
+	using namespace PositionGenerator;
+	Generator Gen(benchParameter(static_cast<int>(state.range(0)), RandomPolicy::CounterBased));
+	Gen.generateData(TickDuration);
+	TickSnapshot Snapshot;
+	for (auto _ : state)
+	{
+		Gen.captureSnapshot(Snapshot);
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CaptureSnapshot)->RangeMultiplier(100)->Range(100, 1000000)->Unit(benchmark::kMicrosecond);
+
+// generateData including the grid update and the search for sensors closer than 1m
+void BM_ProximityEvents(benchmark::State& state)
+{
+	using namespace PositionGenerator;
+	Generator Gen(benchParameter(static_cast<int>(state.range(0)), RandomPolicy::CounterBased).setProximityRadius(1.f));
+	timestamp_t timestamp = 0;
+	for (auto _ : state)
+	{
+		timestamp += TickDuration;
+		Gen.generateData(timestamp);
+		benchmark::DoNotOptimize(Gen.proximityEvents().data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	state.counters["events"] = static_cast<double>(Gen.proximityEvents().size());
+}
+BENCHMARK(BM_ProximityEvents)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
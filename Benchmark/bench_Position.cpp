@@ -0,0 +1,86 @@
+#include <cstddef>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "Position.h"
+
+namespace
+{
+	// enough vectors to keep the compiler from folding the operations, few enough to stay in L1
+	constexpr std::size_t NumVectors = 1024;
+
+	std::vector<PositionGenerator::Vector3> benchVectors()
+	{
+		using namespace PositionGenerator;
+		std::vector<Vector3> Vectors;
+		Vectors.reserve(NumVectors);
+		for (std::size_t i = 0; i < NumVectors; ++i)
+			Vectors.emplace_back(1.f + i * 0.5f, 2.f - i * 0.25f, 0.1f * i);
+		return Vectors;
+	}
+}
+
+void BM_Vector3Normalize(benchmark::State& state)
+{
+	using namespace PositionGenerator;
+	auto Vectors = benchVectors();
+	for (auto _ : state)
+	{
+		for (auto& V : Vectors)
+		{
+			// normalized vectors stay normalized, the work per call is the same in every iteration
+			V.normalize();
+		}
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * NumVectors);
+}
+BENCHMARK(BM_Vector3Normalize);
+
+void BM_Vector3Add(benchmark::State& state)
+{
+	using namespace PositionGenerator;
+	auto Vectors = benchVectors();
+	for (auto _ : state)
+	{
+		Vector3 Sum(0.f, 0.f, 0.f);
+		for (const auto& V : Vectors)
+			Sum = Sum + V;
+		benchmark::DoNotOptimize(Sum);
+	}
+	state.SetItemsProcessed(state.iterations() * NumVectors);
+}
+BENCHMARK(BM_Vector3Add);
+
+void BM_Vector3Sub(benchmark::State& state)
+{
+	using namespace PositionGenerator;
+	auto Vectors = benchVectors();
+	for (auto _ : state)
+	{
+		Vector3 Diff(0.f, 0.f, 0.f);
+		for (const auto& V : Vectors)
+			Diff = Diff - V;
+		benchmark::DoNotOptimize(Diff);
+	}
+	state.SetItemsProcessed(state.iterations() * NumVectors);
+}
+BENCHMARK(BM_Vector3Sub);
+
+void BM_Vector3Scale(benchmark::State& state)
+{
+	using namespace PositionGenerator;
+	auto Vectors = benchVectors();
+	// alternating scales keep the values in range, a constant one would decay them into denormals and zero
+	float scale = 0.999f;
+	for (auto _ : state)
+	{
+		for (auto& V : Vectors)
+			V = V * scale;
+		scale = 1.f / scale;
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * NumVectors);
+}
+BENCHMARK(BM_Vector3Scale);
@@ -0,0 +1,73 @@
+#include <cstdint>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "AllocationCounter.h"
+#include "Generator.h"
+#include "MessageBuilder.h"
+
+namespace
+{
+	PositionGenerator::TickSnapshot benchSnapshot(int numSensors)
+	{
+		using namespace PositionGenerator;
+		Generator Gen(GenerationParameter().setNumOfSensors(numSensors).setRandomPolicy(RandomPolicy::CounterBased));
+		Gen.generateData(40000);
+		TickSnapshot Snapshot;
+		Gen.captureSnapshot(Snapshot);
+		return Snapshot;
+	}
+}
+
+void BM_GenerateMessageData(benchmark::State& state)
+{
+	using namespace PositionGenerator;
+	auto Snapshot = benchSnapshot(1000);
+	GeneratedPosition Msg;
+	std::vector<uint8_t> Out(MaxPositionMessageSize);
+	std::size_t bytes = generateMessageData(Snapshot, 0, Msg, Out.data(), Out.size());
+	const uint64_t allocationsBefore = heapAllocations();
+	for (auto _ : state)
+	{
+		for (std::size_t i = 0; i < Snapshot.size(); ++i)
+			bytes += generateMessageData(Snapshot, i, Msg, Out.data(), Out.size());
+		benchmark::ClobberMemory();
+	}
+	state.counters["allocs/msg"] = static_cast<double>(heapAllocations() - allocationsBefore) / static_cast<double>(state.iterations() * Snapshot.size());
+	state.SetItemsProcessed(state.iterations() * Snapshot.size());
+	state.SetBytesProcessed(bytes);
+}
+BENCHMARK(BM_GenerateMessageData);
+
+// whole tick into a pooled buffer, range(1) selects the wire format
+void BM_BuildTick(benchmark::State& state)
+{
+	using namespace PositionGenerator;
+	auto Snapshot = benchSnapshot(static_cast<int>(state.range(0)));
+	PublishFormat Format;
+	Format.format = static_cast<WireFormat>(state.range(1));
+	BufferPool Pool(2, tickBufferSize(Format, Snapshot.size()));
+	MessageBuilder Builder(Pool, Format);
+	TickFrames Frames;
+	std::size_t bytes = 0;
+	// warm up, the first tick sizes the frame list and the messages
+	Builder.buildTick(Snapshot, Frames);
+	Frames.pBuffer->release();
+	const uint64_t allocationsBefore = heapAllocations();
+	for (auto _ : state)
+	{
+		// always the same snapshot, for WireFormat::Delta all ticks between the keyframes are zero deltas
+		Builder.buildTick(Snapshot, Frames);
+		bytes += Frames.pBuffer->size();
+		Frames.pBuffer->release();
+		Frames.pBuffer = nullptr;
+	}
+	state.counters["allocs/tick"] = static_cast<double>(heapAllocations() - allocationsBefore) / static_cast<double>(state.iterations());
+	state.SetItemsProcessed(state.iterations() * Snapshot.size());
+	state.SetBytesProcessed(bytes);
+	state.SetLabel(wireFormatName(Format.format));
+}
+BENCHMARK(BM_BuildTick)
+	->ArgsProduct({ { 10, 1000, 100000 }, { static_cast<int64_t>(PositionGenerator::WireFormat::Single), static_cast<int64_t>(PositionGenerator::WireFormat::Batch), static_cast<int64_t>(PositionGenerator::WireFormat::Delta) } })
+	->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,60 @@
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#include "benchmark/benchmark.h"
+
+#include "AllocationCounter.h"
+
+namespace
+{
+	std::atomic<uint64_t> g_NumAllocations = 0;
+
+	void* allocate(std::size_t size, std::size_t alignment)
+	{
+		g_NumAllocations.fetch_add(1, std::memory_order_relaxed);
+		if (size == 0)
+			size = 1;
+#ifdef _WIN32
+		void* p = alignment > 0 ? _aligned_malloc(size, alignment) : std::malloc(size);
+#else
+		// aligned_alloc wants a multiple of the alignment
+		void* p = alignment > 0 ? std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment) : std::malloc(size);
+#endif
+		if (!p)
+			throw std::bad_alloc();
+		return p;
+	}
+
+	void deallocate(void* p, bool aligned)
+	{
+#ifdef _WIN32
+		if (aligned)
+		{
+			_aligned_free(p);
+			return;
+		}
+#else
+		(void)aligned;
+#endif
+		std::free(p);
+	}
+}
+
+uint64_t heapAllocations()
+{
+	return g_NumAllocations.load(std::memory_order_relaxed);
+}
+
+// the array and nothrow forms of the standard library forward to these
+void* operator new(std::size_t size) { return allocate(size, 0); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return allocate(size, static_cast<std::size_t>(alignment)); }
+void operator delete(void* p) noexcept { deallocate(p, false); }
+void operator delete(void* p, std::size_t) noexcept { deallocate(p, false); }
+void operator delete(void* p, std::align_val_t) noexcept { deallocate(p, true); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { deallocate(p, true); }
+
+// results as json for comparisons between releases:
+//   Benchmark --benchmark_out=results.json --benchmark_out_format=json
+BENCHMARK_MAIN();
@@ -0,0 +1,199 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "MessageBuilder.h"
+
+namespace PositionGenerator
+{
+  namespace
+  {
+    // the tick buffer is sized from upper bounds of the message sizes, running out of room is a bug in them
+    [[noreturn]] void tooSmall()
+    {
+      throw std::logic_error("MessageBuilder: tick buffer too small for the messages of the tick");
+    }
+  }
+
+  std::size_t generateMessageData(const TickSnapshot& Snapshot, std::size_t index, GeneratedPosition& Msg, uint8_t* pOut, std::size_t capacity)
+  {
+    // all fields are required and overwritten, so no Clear() needed - mutable_position() reuses the submessage
+    Data3d* pCoord = Msg.mutable_position();
+    pCoord->set_x(Snapshot.x[index]);
+    pCoord->set_y(Snapshot.y[index]);
+    pCoord->set_z(Snapshot.z[index]);
+    Msg.set_sensorid(Snapshot.sensorIds[index]);
+    Msg.set_timestamp_usec(Snapshot.timestamps[index]);
+
+    const std::size_t size = Msg.ByteSizeLong();
+    if (size > capacity)
+      return 0;
+    Msg.SerializeWithCachedSizesToArray(pOut);
+    return size;
+  }
+
+  void releaseFrame(void* /*data*/, void* hint)
+  {
+    static_cast<BufferPool::Buffer*>(hint)->release();
+  }
+
+  const char* wireFormatName(WireFormat format)
+  {
+    switch (format)
+    {
+    case WireFormat::Batch: return "batch";
+    case WireFormat::Delta: return "delta";
+    default: return "single";
+    }
+  }
+
+  WireFormat parseWireFormat(const std::string& Name)
+  {
+    for (auto format : { WireFormat::Single, WireFormat::Batch, WireFormat::Delta })
+    {
+      if (Name == wireFormatName(format))
+        return format;
+    }
+    throw std::invalid_argument("unknown wire format '" + Name + "' (single, batch or delta)");
+  }
+
+  std::size_t tickBufferSize(const PublishFormat& Format, std::size_t numSensors)
+  {
+    if (Format.format != WireFormat::Single)
+    {
+      const std::size_t batchSize = Format.batchSize > 0 ? Format.batchSize : std::max<std::size_t>(numSensors, 1);
+      const std::size_t numFrames = (numSensors + batchSize - 1) / batchSize;
+      const std::size_t entrySize = Format.format == WireFormat::Delta ? MaxDeltaEntrySize : MaxBatchEntrySize;
+      return numSensors * entrySize + numFrames * MaxBatchOverhead;
+    }
+    return numSensors * MaxPositionMessageSize;
+  }
+
+  void MessageBuilder::buildTick(const TickSnapshot& Snapshot, TickFrames& Frames)
+  {
+    const std::size_t numSensors = Snapshot.size();
+    Frames.pBuffer = m_Pool.acquire(tickBufferSize(m_Format, numSensors));
+    Frames.FrameEnd.clear();
+
+    try
+    {
+      if (m_Format.format == WireFormat::Batch)
+        buildBatchTick(Snapshot, Frames);
+      else if (m_Format.format == WireFormat::Delta)
+        buildDeltaTick(Snapshot, Frames);
+      else
+        buildSingleTick(Snapshot, Frames);
+    }
+    catch (...)
+    {
+      // nothing is sent, the buffer goes back to the pool
+      Frames.pBuffer->release();
+      Frames.pBuffer = nullptr;
+      Frames.FrameEnd.clear();
+      throw;
+    }
+  }
+
+  void MessageBuilder::buildSingleTick(const TickSnapshot& Snapshot, TickFrames& Frames)
+  {
+    const std::size_t numSensors = Snapshot.size();
+    Frames.FrameEnd.reserve(numSensors);
+
+    uint8_t* pData = Frames.pBuffer->data();
+    const std::size_t capacity = Frames.pBuffer->capacity();
+    std::size_t offset = 0;
+    for (std::size_t i = 0; i < numSensors; ++i)
+    {
+      auto written = generateMessageData(Snapshot, i, m_Msg, pData + offset, capacity - offset);
+      if (written == 0)
+        tooSmall(); // MaxPositionMessageSize does not hold
+      offset += written;
+      Frames.FrameEnd.push_back(offset);
+    }
+    Frames.pBuffer->setSize(offset);
+  }
+
+  void MessageBuilder::buildBatchTick(const TickSnapshot& Snapshot, TickFrames& Frames)
+  {
+    const std::size_t numSensors = Snapshot.size();
+    const std::size_t batchSize = m_Format.batchSize > 0 ? m_Format.batchSize : std::max<std::size_t>(numSensors, 1);
+
+    uint8_t* pData = Frames.pBuffer->data();
+    const std::size_t capacity = Frames.pBuffer->capacity();
+    std::size_t offset = 0;
+    std::size_t inBatch = 0;
+    m_Batch.Clear();
+    for (std::size_t i = 0; i < numSensors; ++i)
+    {
+      m_Batch.add_sensorid(Snapshot.sensorIds[i]);
+      m_Batch.add_timestamp_usec(Snapshot.timestamps[i]);
+      m_Batch.add_x(Snapshot.x[i]);
+      m_Batch.add_y(Snapshot.y[i]);
+      m_Batch.add_z(Snapshot.z[i]);
+      if (++inBatch == batchSize)
+      {
+        offset += serializeBatch(pData + offset, capacity - offset);
+        Frames.FrameEnd.push_back(offset);
+        m_Batch.Clear();
+        inBatch = 0;
+      }
+    }
+    if (inBatch > 0)
+    {
+      offset += serializeBatch(pData + offset, capacity - offset);
+      Frames.FrameEnd.push_back(offset);
+    }
+    Frames.pBuffer->setSize(offset);
+  }
+
+  void MessageBuilder::buildDeltaTick(const TickSnapshot& Snapshot, TickFrames& Frames)
+  {
+    const std::size_t numSensors = Snapshot.size();
+    const std::size_t batchSize = m_Format.batchSize > 0 ? m_Format.batchSize : std::max<std::size_t>(numSensors, 1);
+    m_Encoder.encode(Snapshot, m_Encoded);
+
+    uint8_t* pData = Frames.pBuffer->data();
+    const std::size_t capacity = Frames.pBuffer->capacity();
+    std::size_t offset = 0;
+    for (std::size_t first = 0; first < numSensors; first += batchSize)
+    {
+      const std::size_t last = std::min(first + batchSize, numSensors);
+      offset += serializeDelta(first, last, pData + offset, capacity - offset);
+      Frames.FrameEnd.push_back(offset);
+    }
+    Frames.pBuffer->setSize(offset);
+  }
+
+  std::size_t MessageBuilder::serializeDelta(std::size_t first, std::size_t last, uint8_t* pOut, std::size_t capacity)
+  {
+    m_Delta.Clear();
+    m_Delta.set_keyframe(m_Encoded.keyframe);
+    m_Delta.set_resolution(m_Encoded.resolution);
+    m_Delta.set_timestamp_usec(m_Encoded.tickTimestamp);
+    sensorId_t previousId = 0;
+    for (std::size_t i = first; i < last; ++i)
+    {
+      // consecutive ids, the common case, cost one byte each
+      m_Delta.add_sensorid_delta(static_cast<int64_t>(m_Encoded.sensorIds[i] - previousId));
+      previousId = m_Encoded.sensorIds[i];
+      m_Delta.add_timestamp_offset(m_Encoded.timestampOffsets[i]);
+      m_Delta.add_x(m_Encoded.x[i]);
+      m_Delta.add_y(m_Encoded.y[i]);
+      m_Delta.add_z(m_Encoded.z[i]);
+    }
+
+    const std::size_t size = m_Delta.ByteSizeLong();
+    if (size > capacity)
+      tooSmall(); // MaxDeltaEntrySize or MaxBatchOverhead do not hold
+    m_Delta.SerializeWithCachedSizesToArray(pOut);
+    return size;
+  }
+
+  std::size_t MessageBuilder::serializeBatch(uint8_t* pOut, std::size_t capacity)
+  {
+    const std::size_t size = m_Batch.ByteSizeLong();
+    if (size > capacity)
+      tooSmall(); // MaxBatchEntrySize or MaxBatchOverhead do not hold
+    m_Batch.SerializeWithCachedSizesToArray(pOut);
+    return size;
+  }
+}
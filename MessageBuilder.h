@@ -0,0 +1,104 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "protobuf/SensorPosition.pb.h"
+#include "BufferPool.h"
+#include "PositionCodec.h"
+#include "TickSnapshot.h"
+
+namespace PositionGenerator
+{
+  // upper bound of a serialized GeneratedPosition: two 64 bit varints and three fixed floats plus tags
+  constexpr std::size_t MaxPositionMessageSize = 48;
+  // upper bound per sensor in a GeneratedPositionBatch (two varints, three floats) and per batch message (tags and lengths)
+  constexpr std::size_t MaxBatchEntrySize = 32;
+  constexpr std::size_t MaxBatchOverhead = 64;
+  // upper bound per sensor in a GeneratedPositionDelta (two 64 bit and three 32 bit varints), the batch overhead applies as well
+  constexpr std::size_t MaxDeltaEntrySize = 40;
+
+  // layout of the published data
+  enum class WireFormat
+  {
+    Single,   // one GeneratedPosition per sensor and frame
+    Batch,    // one GeneratedPositionBatch per frame
+    Delta     // one GeneratedPositionDelta per frame, quantized and delta coded between keyframes
+  };
+
+  // "single", "batch" or "delta"
+  const char* wireFormatName(WireFormat format);
+  // inverse of wireFormatName, throws std::invalid_argument for other names
+  WireFormat parseWireFormat(const std::string& Name);
+
+  struct PublishFormat
+  {
+    WireFormat format = WireFormat::Single;
+    std::size_t batchSize = 0; // sensors per batch frame, 0 sends the whole tick in one frame
+    float resolution = 0.001f; // WireFormat::Delta: meters per quantization step
+    uint32_t keyframeInterval = 50; // WireFormat::Delta: updates of a sensor from one keyframe to the next
+  };
+
+  // all messages of one tick, serialized back to back into one pooled buffer
+  struct TickFrames
+  {
+    BufferPool::Buffer* pBuffer = nullptr;   // holds one reference, released by the sender
+    std::vector<std::size_t> FrameEnd;       // end offset of every message, capacity is kept between ticks
+  };
+
+  // called by zeromq once it does not need the data of a zero-copy message anymore, hint is the tick buffer
+  void releaseFrame(void* data, void* hint);
+
+  // hands every frame of the tick zero-copy to Send(uint8_t* pData, std::size_t size, BufferPool::Buffer* pBuffer)
+  // every frame holds a reference on the tick buffer that the receiver gives back with releaseFrame,
+  // the reference of the builder is dropped at the end, so the buffer goes back to the pool with the last frame
+  template <typename Send_t>
+  void sendFrames(TickFrames& Frames, Send_t&& Send)
+  {
+    BufferPool::Buffer* pBuffer = Frames.pBuffer;
+    std::size_t begin = 0;
+    for (auto end : Frames.FrameEnd)
+    {
+      pBuffer->addRef();
+      Send(pBuffer->data() + begin, end - begin, pBuffer);
+      begin = end;
+    }
+    pBuffer->release();
+    Frames.pBuffer = nullptr;
+  }
+
+  // capacity of the tick buffer needed for numSensors sensors
+  std::size_t tickBufferSize(const PublishFormat& Format, std::size_t numSensors);
+
+  // serializes sensor index of the snapshot into pOut, returns the number of bytes written (0 if capacity is too small)
+  std::size_t generateMessageData(const TickSnapshot& Snapshot, std::size_t index, GeneratedPosition& Msg, uint8_t* pOut, std::size_t capacity);
+
+  // builds the messages of a tick without heap allocations once the pool and the frame list are warmed up
+  class MessageBuilder
+  {
+  public:
+    explicit MessageBuilder(BufferPool& Pool, const PublishFormat& Format = PublishFormat())
+      : m_Pool(Pool), m_Format(Format), m_Encoder(Format.resolution, Format.keyframeInterval) {}
+
+    // serializes all sensors of the snapshot
+    // throws std::logic_error if the messages do not fit into the tick buffer, Frames then holds no buffer
+    void buildTick(const TickSnapshot& Snapshot, TickFrames& Frames);
+
+  private:
+    BufferPool& m_Pool;
+    PublishFormat m_Format;
+    GeneratedPosition m_Msg; // reused for every sensor, keeps its position submessage allocated
+    GeneratedPositionBatch m_Batch; // Clear() keeps the capacity of the repeated fields
+    // delta coding keeps the quantized positions of the previous tick, so ticks have to be built in order
+    PositionEncoder m_Encoder;
+    EncodedTick m_Encoded;
+    GeneratedPositionDelta m_Delta;
+
+    void buildSingleTick(const TickSnapshot& Snapshot, TickFrames& Frames);
+    void buildBatchTick(const TickSnapshot& Snapshot, TickFrames& Frames);
+    void buildDeltaTick(const TickSnapshot& Snapshot, TickFrames& Frames);
+    std::size_t serializeBatch(uint8_t* pOut, std::size_t capacity);
+    std::size_t serializeDelta(std::size_t first, std::size_t last, uint8_t* pOut, std::size_t capacity);
+  };
+}
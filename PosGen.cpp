@@ -1,103 +1,484 @@
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <future>
 #include <iostream>
+#include <memory>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <vector>
 
 #include "zmq.hpp"
-#include "protobuf/SensorPosition.pb.h"
+#include "BufferPool.h"
 #include "Generator.h"
+#include "MessageBuilder.h"
+#include "PositionDataset.h"
+#include "PublishPipeline.h"
+#include "Settings.h"
+#include "TickLog.h"
+#include "TickScheduler.h"
+#include "TickStats.h"
 
-using DataList_t = std::vector<std::string>;
 using namespace PositionGenerator;
 
-std::string generateMessageData(const PositionGenerator::SensorPosition& Sensor, PositionGenerator::ChronoBasedGenerator& Gen)
+// with a topic every frame is sent as two part message, the topic first, so SUB sockets can filter on it
+void sendTick(zmq::socket_t& socket, TickFrames& Frames, TickStats* pStats, std::string_view Topic = {})
 {
-  Vector3 PosWithNoise = Gen.addNoise(Sensor.position());
-  GeneratedPosition Pos;
-  Data3d* pCoord = Pos.mutable_position();
-  pCoord->set_x(PosWithNoise.x());
-  pCoord->set_y(PosWithNoise.y());
-  pCoord->set_z(PosWithNoise.z());
-  Pos.set_sensorid(Sensor.sensorId());
-  Pos.set_timestamp_usec(Sensor.timestamp());
-
-  std::string bytes;
-  Pos.SerializeToString(&bytes);
-
-  return bytes;
+  StageTimer Timer(pStats, TickStage::Send);
+  if (pStats)
+    pStats->countMessages(Frames.FrameEnd.size(), Frames.pBuffer->size());
+  sendFrames(Frames, [&](uint8_t* pData, std::size_t size, BufferPool::Buffer* pBuffer)
+    {
+      if (!Topic.empty())
+        socket.send(zmq::buffer(Topic), zmq::send_flags::sndmore);
+      // zeromq owns the frame's reference on the tick buffer now, even if sending fails
+      zmq::message_t msg(pData, size, releaseFrame, pBuffer);
+      auto res = socket.send(msg, zmq::send_flags::none);
+      if (!res.has_value() || res.value() == 0)
+      {
+        // error - for now just log to std::output
+        std::cout << " transmission error \n";
+      }
+    });
 }
 
-DataList_t generateMessagesForSingleLoop(PositionGenerator::ChronoBasedGenerator& Gen)
+// wait for the next deadline, the work of this tick is already part of the period
+void waitForNextTick(TickScheduler& Scheduler, TickStats* pStats)
 {
-  DataList_t msgDataList;
-  Gen.generateData();
-  for (const auto& Sensor : Gen)
+  auto Tick = Scheduler.waitForNextTick();
+  if (pStats)
+    pStats->record(TickStage::Slack, Tick.slack);
+  if (Tick.missedTicks > 0)
   {
-    msgDataList.emplace_back(std::move(generateMessageData(Sensor, Gen)));
+    std::cout << " overrun: missed " << Tick.missedTicks << " ticks (" << Scheduler.totalMissedTicks() << " in total) \n";
   }
-  return msgDataList;
 }
 
-void messageLoop(std::atomic_bool& StopSignal, zmq::socket_t& socket, PositionGenerator::ChronoBasedGenerator& Gen, float FrequencyInHz)
+// generates the next tick into Snapshot, moving and noise are timed as separate stages
+// with update rates the snapshot only holds the sensors due on this tick
+void generateTick(PositionGenerator::ChronoBasedGenerator& Gen, TickSnapshot& Snapshot, TickStats* pStats)
 {
+  if (pStats)
+    pStats->countTick();
+  {
+    StageTimer Timer(pStats, TickStage::Generate);
+    Gen.generateData();
+  }
+  StageTimer Timer(pStats, TickStage::Noise);
+  Gen.captureUpdates(Snapshot);
+}
+
+void messageLoop(std::atomic_bool& StopSignal, zmq::socket_t& socket, BufferPool& Pool, PublishFormat Format, PositionGenerator::ChronoBasedGenerator& Gen, float FrequencyInHz, std::chrono::nanoseconds SpinWindow, bool Pipelined, TickStats* pStats)
+{
+  MessageBuilder Builder(Pool, Format);
+  TickScheduler Scheduler(FrequencyInHz, SpinWindow);
+
+  if (Pipelined)
+  {
+    // this thread only generates, serializing and sending overlap with the next tick
+    // the sender thread is the only one touching the socket
+    PublishPipeline Pipeline(Builder, [&socket, pStats](TickFrames& Frames) { sendTick(socket, Frames, pStats); }, 4, pStats);
+    while (!StopSignal)
+    {
+      TickSnapshot* pSnapshot = Pipeline.acquireSnapshot();
+      generateTick(Gen, *pSnapshot, pStats);
+      Pipeline.submit(pSnapshot);
+      waitForNextTick(Scheduler, pStats);
+    }
+    Pipeline.stop();
+    return;
+  }
+
+  TickSnapshot Snapshot;
+  TickFrames Frames;
   while (!StopSignal)
   {
-    auto msgDataList = generateMessagesForSingleLoop(Gen);
-    for (const auto& msgData : msgDataList)
+    generateTick(Gen, Snapshot, pStats);
     {
-      zmq::const_buffer data(msgData.data(), msgData.size());
-      auto res = socket.send(data, zmq::send_flags::none);
-      if (!res.has_value() || res.value() == 0)
-      {
-        // error - for now just log to std::output
-        std::cout << " transmission error \n";
-      }
+      StageTimer Timer(pStats, TickStage::Serialize);
+      Builder.buildTick(Snapshot, Frames);
+    }
+    sendTick(socket, Frames, pStats);
+    waitForNextTick(Scheduler, pStats);
+  }
+}
+
+// topic of a shard, fixed width so subscribing to one shard does not match others as prefix
+std::string shardTopic(std::size_t shard)
+{
+  std::string Topic = std::to_string(shard);
+  return "shard" + std::string(Topic.size() < 4 ? 4 - Topic.size() : 0, '0') + Topic + "/";
+}
+
+// endpoint of a shard: tcp endpoints count up the port of Base, all others (ipc, inproc) get the shard number appended
+std::string shardEndpoint(const std::string& Base, std::size_t shard)
+{
+  if (Base.rfind("tcp://", 0) == 0)
+  {
+    auto colon = Base.rfind(':');
+    if (colon == std::string::npos || colon + 1 >= Base.size() || Base.find_first_not_of("0123456789", colon + 1) != std::string::npos)
+      throw std::invalid_argument("no port in endpoint " + Base);
+    return Base.substr(0, colon + 1) + std::to_string(std::stoul(Base.substr(colon + 1)) + shard);
+  }
+  return Base + "-" + std::to_string(shard);
+}
+
+// one socket per shard of the sensors (shardOf their sensorId), each shard is serialized and sent on its own threads
+// the calling thread generates and splits the ticks
+void shardedMessageLoop(std::atomic_bool& StopSignal, std::vector<zmq::socket_t>& Sockets, std::vector<std::unique_ptr<BufferPool>>& Pools, PublishFormat Format, PositionGenerator::ChronoBasedGenerator& Gen, float FrequencyInHz, std::chrono::nanoseconds SpinWindow, TickStats* pStats)
+{
+  const std::size_t numShards = Sockets.size();
+  TickScheduler Scheduler(FrequencyInHz, SpinWindow);
+  std::vector<std::unique_ptr<MessageBuilder>> Builders;
+  // declared after the builders, the pipelines have to stop before their builders go away
+  std::vector<std::unique_ptr<PublishPipeline>> Pipelines;
+  for (std::size_t shard = 0; shard < numShards; ++shard)
+  {
+    Builders.push_back(std::make_unique<MessageBuilder>(*Pools[shard], Format));
+    Pipelines.push_back(std::make_unique<PublishPipeline>(*Builders[shard],
+      [&socket = Sockets[shard], Topic = shardTopic(shard), pStats](TickFrames& Frames) { sendTick(socket, Frames, pStats, Topic); }, 4, pStats));
+  }
+
+  TickSnapshot Snapshot;
+  std::vector<TickSnapshot*> ShardSnapshots(numShards);
+  std::vector<std::size_t> ShardCounts(numShards);
+  while (!StopSignal)
+  {
+    generateTick(Gen, Snapshot, pStats);
+    for (std::size_t shard = 0; shard < numShards; ++shard)
+      ShardSnapshots[shard] = Pipelines[shard]->acquireSnapshot();
+    splitSnapshot(Snapshot, ShardSnapshots, ShardCounts);
+    for (std::size_t shard = 0; shard < numShards; ++shard)
+      Pipelines[shard]->submit(ShardSnapshots[shard]);
+    waitForNextTick(Scheduler, pStats);
+  }
+  for (auto& pPipeline : Pipelines)
+    pPipeline->stop();
+}
+
+// publishes a recorded run, paced by the recorded timestamps divided by Speed (0 = as fast as possible)
+void replayLoop(std::atomic_bool& StopSignal, zmq::socket_t& socket, BufferPool& Pool, PublishFormat Format, PositionGenerator::ReplayGenerator& Gen, double Speed, TickStats* pStats)
+{
+  MessageBuilder Builder(Pool, Format);
+  TickSnapshot Snapshot;
+  TickFrames Frames;
+  const TickLog& Log = Gen.log();
+  const double nsPerUnit = 1.E9 / static_cast<double>(Log.timestampUnitsPerSecond());
+  const timestamp_t firstTimestamp = Log.size() > 0 ? Log.timestamps().front() : 0;
+  auto Start = std::chrono::steady_clock::now();
+
+  std::size_t numTicks = 0;
+  while (!StopSignal)
+  {
+    {
+      StageTimer Timer(pStats, TickStage::Generate);
+      if (!Gen.generateData())
+        break;
+    }
+    {
+      StageTimer Timer(pStats, TickStage::Noise);
+      Gen.captureUpdates(Snapshot);
+    }
+    {
+      StageTimer Timer(pStats, TickStage::Serialize);
+      Builder.buildTick(Snapshot, Frames);
+    }
+    if (Speed > 0.)
+    {
+      auto offsetNs = static_cast<double>(Gen.currentTimestamp() - firstTimestamp) * nsPerUnit / Speed;
+      auto Deadline = Start + std::chrono::nanoseconds(std::llround(offsetNs));
+      if (pStats)
+        pStats->record(TickStage::Slack, std::max(Deadline - std::chrono::steady_clock::now(), std::chrono::steady_clock::duration::zero()));
+      std::this_thread::sleep_until(Deadline);
     }
-    // now wait 1000ms
-    std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<int>(1000.f/FrequencyInHz)));
+    sendTick(socket, Frames, pStats);
+    if (pStats)
+      pStats->countTick();
+    ++numTicks;
   }
+  auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+  std::cout << " replayed " << numTicks << " of " << Log.size() << " ticks in " << elapsed << "s \n";
 }
 
-int main()
+// the dataset mapping outlives the zmq context, frames pointing into it need no release
+void keepMapped(void* /*data*/, void* /*hint*/)
+{
+}
+
+// two frames per tick, both zero-copy out of the mapping:
+// the TickIndexEntry (timestamp, number of records) and the tick block with the columns sensorId, timestamp, x, y, z
+// the column offsets of a block follow from the number of records, see makeDatasetHeader
+void sendDatasetTick(zmq::socket_t& socket, const DatasetTick& Tick, TickStats* pStats)
+{
+  StageTimer Timer(pStats, TickStage::Send);
+  if (pStats)
+  {
+    pStats->countMessages(1, sizeof(TickIndexEntry) + Tick.blockSize);
+    pStats->countTick();
+  }
+  zmq::message_t Index(const_cast<TickIndexEntry*>(Tick.pIndexEntry), sizeof(TickIndexEntry), keepMapped);
+  zmq::message_t Block(const_cast<uint8_t*>(Tick.pBlock), Tick.blockSize, keepMapped);
+  auto resIndex = socket.send(Index, zmq::send_flags::sndmore);
+  auto resBlock = socket.send(Block, zmq::send_flags::none);
+  if (!resIndex.has_value() || !resBlock.has_value())
+  {
+    // error - for now just log to std::output
+    std::cout << " transmission error \n";
+  }
+}
+
+// publishes a pre-generated dataset, at a fixed rate if RateInHz > 0,
+// otherwise paced by the recorded timestamps divided by Speed (0 = as fast as possible)
+void datasetLoop(std::atomic_bool& StopSignal, zmq::socket_t& socket, const DatasetReader& Reader, double RateInHz, double Speed, std::chrono::nanoseconds SpinWindow, TickStats* pStats)
+{
+  const std::size_t numTicks = Reader.numTicks();
+  const double nsPerUnit = 1.E9 / static_cast<double>(Reader.header().timestampUnitsPerSecond);
+  const timestamp_t firstTimestamp = numTicks > 0 ? Reader.tick(0).tickTimestamp : 0;
+  TickScheduler Scheduler(RateInHz > 0. ? RateInHz : 1., SpinWindow);
+  auto Start = std::chrono::steady_clock::now();
+
+  std::size_t tick = 0;
+  for (; tick < numTicks && !StopSignal; ++tick)
+  {
+    auto Tick = Reader.tick(tick);
+    if (RateInHz <= 0. && Speed > 0.)
+    {
+      auto offsetNs = static_cast<double>(Tick.tickTimestamp - firstTimestamp) * nsPerUnit / Speed;
+      std::this_thread::sleep_until(Start + std::chrono::nanoseconds(std::llround(offsetNs)));
+    }
+    sendDatasetTick(socket, Tick, pStats);
+    if (RateInHz > 0.)
+      waitForNextTick(Scheduler, pStats);
+  }
+  auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+  std::cout << " published " << tick << " of " << numTicks << " ticks in " << elapsed << "s \n";
+}
+
+int main(int argc, char* argv[])
 {
-  constexpr const char BindAddress[] = "tcp://*:4646";
   std::cout << "This is PositionGenerator v0.1 \n";
-  std::cout << "Generating Positions and publishing at " << BindAddress << "\n";
 
   using namespace PositionGenerator;
 
-  // create Generator with suitable parameters
-  float maxVelocity = 12.0; // 12m/s
-  uint64_t timeStampUnitsPerSecond = 1000000; // microsec
-  timestamp_t initialTime = 0;
-  Vector3 minValues(0.f, 0.f, 0.2f);
-  Vector3 maxValues(100.f, 100.f, 1.5f);
-  int numSensors = 10;
-  float noiseDimension = 0.3f;
+  // every setting can be given as --key value on the command line or as key = value in a file loaded with --config <file>,
+  // later values win, see Settings. Besides the GenerationParameter keys (see generationParameter):
+  // --rate <hz>: ticks per second; for --dataset without it the recorded timestamps are followed (scaled by --speed)
+  // --format single|batch|delta, --batch-size <n>: wire format and sensors per batch/delta frame, 0 = one frame per tick
+  // --resolution <m>, --keyframe-interval <n>: quantization step and updates of a sensor between keyframes of the delta format
+  // --pipelined <bool>: generate, serialize and send on separate threads
+  // --spin-window-us <us>: busy wait at the end of each period, 0 only sleeps
+  // --stats-interval <s>: print p50/p99/p999 of every tick stage and the throughput every s seconds, 0 = off
+  // --record <file>: store seed and tick timestamps of the live run
+  // --replay <file> [--speed <factor>]: publish a recorded run again, speed 0 runs as fast as possible
+  // --offline <file> --ticks <n>: write n ticks at --rate to a dataset as fast as possible, no publishing
+  // --dataset <file> [--speed <factor> | --rate <hz>]: publish a pre-generated dataset instead of generating
+  // --bind <endpoint>: where to publish, e.g. tcp://*:4646 or ipc:///tmp/posgen
+  // --shards <n>: live generation publishes through n sockets on n threads, split by sensorId (sensorId % n);
+  //   tcp sockets bind consecutive ports starting at the bind port, others get -0, -1, ... appended,
+  //   every message is preceded by the topic frame "shard0000/", "shard0001/", ...
+  Settings Config;
+  std::string BindAddress;
   float FrequencyInHz = 1.f;
+  std::chrono::nanoseconds SpinWindow;
+  PublishFormat Format;
+  bool Pipelined = false;
+  std::string RecordFile;
+  std::string ReplayFile;
+  double ReplaySpeed = 1.0;
+  std::string OfflineFile;
+  std::size_t OfflineTicks = 0;
+  std::string DatasetFile;
+  double DatasetRate = 0.;
+  std::size_t NumShards = 1;
+  double StatsInterval = 0.;
+  GenerationParameter Param;
+  try
+  {
+    Config.parseCommandLine(argc, argv);
 
-  ChronoBasedGenerator Gen(GenerationParameter()
-    .setMaximalVelocity(maxVelocity)
-    .setNumOfSensors(numSensors)
-    .setInitialTimestamp(initialTime)
-    .setBoundingCuboid(minValues, maxValues)
-    .setTimestampUnitPerSecond(timeStampUnitsPerSecond)
-    .setNoiseDimension(noiseDimension)
-  );
+    // defaults of the generator, the timestamps of a live run are always microseconds since start
+    Param = generationParameter(Config, GenerationParameter()
+      .setMaximalVelocity(12.f) // 12m/s
+      .setNumOfSensors(10)
+      .setInitialTimestamp(0)
+      .setBoundingCuboid(Vector3(0.f, 0.f, 0.2f), Vector3(100.f, 100.f, 1.5f))
+      .setTimestampUnitPerSecond(1000000) // microsec
+      .setNoiseDimension(0.3f));
+
+    BindAddress = Config.getString("bind", "tcp://*:4646");
+    FrequencyInHz = static_cast<float>(Config.getDouble("rate", 1.));
+    DatasetRate = Config.getDouble("rate", 0.);
+    SpinWindow = std::chrono::microseconds(Config.getUInt("spin-window-us", 200));
+    Format.format = parseWireFormat(Config.getString("format", wireFormatName(WireFormat::Single)));
+    Format.batchSize = Config.getUInt("batch-size", 0);
+    Format.resolution = static_cast<float>(Config.getDouble("resolution", 0.001)); // 1mm steps
+    Format.keyframeInterval = static_cast<uint32_t>(Config.getUInt("keyframe-interval", 50)); // late subscribers sync up within 50 updates of a sensor
+    Pipelined = Config.getBool("pipelined", false);
+    RecordFile = Config.getString("record", "");
+    ReplayFile = Config.getString("replay", "");
+    ReplaySpeed = Config.getDouble("speed", 1.);
+    OfflineFile = Config.getString("offline", "");
+    OfflineTicks = Config.getUInt("ticks", 0);
+    DatasetFile = Config.getString("dataset", "");
+    NumShards = std::max<std::size_t>(Config.getUInt("shards", 1), 1);
+    StatsInterval = Config.getDouble("stats-interval", 0.);
+    if (!(FrequencyInHz > 0.f) || !std::isfinite(FrequencyInHz))
+      throw std::invalid_argument("rate has to be positive");
+  }
+  catch (const std::exception& e)
+  {
+    std::cout << e.what() << "\n";
+    return 1;
+  }
+  for (const auto& Key : Config.unusedKeys())
+    std::cout << "  ignoring unknown option " << Key << "\n";
+
+  if (!OfflineFile.empty())
+  {
+    // synthetic timestamps, all hardware threads unless configured otherwise
+    Generator Offline(Config.has("threads") ? Param : GenerationParameter(Param).setNumOfThreads(0));
+    auto tickInterval = static_cast<timestamp_t>(std::llround(Param.timeStampPerSecond() / FrequencyInHz));
+    auto Start = std::chrono::steady_clock::now();
+    try
+    {
+      auto bytes = generateDataset(Offline, OfflineFile, OfflineTicks, tickInterval);
+      auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+      std::cout << "  wrote " << OfflineTicks << " ticks (" << bytes / (1024 * 1024) << " MiB) to " << OfflineFile << " in " << elapsed << "s \n";
+    }
+    catch (const std::exception& e)
+    {
+      std::cout << e.what() << "\n";
+      return 1;
+    }
+    return 0;
+  }
+
+  // the mapping of a dataset has to outlive the zmq objects, queued messages point into it
+  std::unique_ptr<DatasetReader> pDataset;
+  // replay needs the same parameters as the recorded run, seed and time base come from the log
+  std::unique_ptr<ReplayGenerator> pReplay;
+  std::unique_ptr<ChronoBasedGenerator> pLive;
+  TickLog Record;
+  try
+  {
+    if (!DatasetFile.empty())
+    {
+      pDataset = std::make_unique<DatasetReader>(DatasetFile);
+      std::cout << "Publishing " << pDataset->numTicks() << " ticks of " << pDataset->numSensors() << " sensors from " << DatasetFile << "\n";
+    }
+    else if (!ReplayFile.empty())
+    {
+      pReplay = std::make_unique<ReplayGenerator>(Param, TickLog::load(ReplayFile));
+      std::cout << "Replaying " << pReplay->log().size() << " ticks from " << ReplayFile << "\n";
+    }
+    else
+    {
+      pLive = std::make_unique<ChronoBasedGenerator>(Param);
+      if (!RecordFile.empty())
+        pLive->recordTo(&Record);
+    }
+  }
+  catch (const std::exception& e)
+  {
+    std::cout << e.what() << "\n";
+    return 1;
+  }
+
+  // sharding only applies to live generation, replays and datasets are published through one socket
+  const std::size_t numSockets = pLive ? NumShards : 1;
+  if (NumShards > 1 && !pLive)
+    std::cout << "  --shards is ignored for replays and datasets\n";
+  std::vector<std::string> Endpoints;
+  try
+  {
+    for (std::size_t shard = 0; shard < numSockets; ++shard)
+      Endpoints.push_back(numSockets > 1 ? shardEndpoint(BindAddress, shard) : BindAddress);
+  }
+  catch (const std::exception& e)
+  {
+    std::cout << e.what() << "\n";
+    return 1;
+  }
+  for (const auto& Endpoint : Endpoints)
+    std::cout << "Generating Positions and publishing at " << Endpoint << "\n";
+
+  // a few ticks can be in flight in zeromq (and in the publish pipeline) at the same time
+  // the pools have to outlive the zmq objects, queued messages still point into their buffers
+  constexpr std::size_t NumTickBuffers = 8;
+  const std::size_t numPoolSensors = pReplay ? pReplay->sensors().size() : pLive ? pLive->sensors().size() : 0;
+  BufferPool Pool(pDataset || numSockets > 1 ? 0 : NumTickBuffers, tickBufferSize(Format, numPoolSensors), Param.memoryPolicy());
+  // one pool per shard, the shards do not contend for the pool lock
+  // the pools do not write their buffers, the pages land on the NUMA node of the shard's publish thread
+  std::vector<std::unique_ptr<BufferPool>> ShardPools;
+  if (numSockets > 1)
+  {
+    for (std::size_t shard = 0; shard < numSockets; ++shard)
+      ShardPools.push_back(std::make_unique<BufferPool>(NumTickBuffers, tickBufferSize(Format, (numPoolSensors + numSockets - 1) / numSockets), Param.memoryPolicy()));
+  }
+
+  // shared by all threads of the publish path, nullptr switches the timers off
+  std::unique_ptr<TickStats> pStats = StatsInterval > 0. ? std::make_unique<TickStats>() : nullptr;
 
   // scope to limit life time of async future and zmq sockets
   {
-    zmq::context_t context;
-    zmq::socket_t socket(context, zmq::socket_type::pub);
-    socket.bind(BindAddress);
+    // one I/O thread per socket, a single one caps the fan-out
+    zmq::context_t context(static_cast<int>(numSockets));
+    std::vector<zmq::socket_t> Sockets;
+    for (const auto& Endpoint : Endpoints)
+    {
+      Sockets.emplace_back(context, zmq::socket_type::pub);
+      Sockets.back().bind(Endpoint);
+    }
+    zmq::socket_t& socket = Sockets.front();
     std::atomic_bool StopSignal = false;
-    auto voidFuture = std::async(messageLoop, std::ref(StopSignal), std::ref(socket), std::ref(Gen),FrequencyInHz);
+    auto voidFuture = std::async([&]()
+      {
+        if (pDataset)
+          datasetLoop(StopSignal, socket, *pDataset, DatasetRate, ReplaySpeed, SpinWindow, pStats.get());
+        else if (pReplay)
+          replayLoop(StopSignal, socket, Pool, Format, *pReplay, ReplaySpeed, pStats.get());
+        else if (numSockets > 1)
+          shardedMessageLoop(StopSignal, Sockets, ShardPools, Format, *pLive, FrequencyInHz, SpinWindow, pStats.get());
+        else
+          messageLoop(StopSignal, socket, Pool, Format, *pLive, FrequencyInHz, SpinWindow, Pipelined, pStats.get());
+      });
+    auto statsFuture = std::async(std::launch::async, [&]()
+      {
+        if (!pStats)
+          return;
+        auto Interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(StatsInterval));
+        auto NextReport = std::chrono::steady_clock::now() + Interval;
+        while (!StopSignal)
+        {
+          // short sleeps, so stopping does not wait for a whole interval
+          std::this_thread::sleep_for(std::chrono::milliseconds(100));
+          if (std::chrono::steady_clock::now() < NextReport)
+            continue;
+          pStats->report(std::cout);
+          NextReport += Interval;
+        }
+      });
     std::cout << "  >>> press RETURN to stop <<<\n ";
     getchar();
     StopSignal = true; // signal thread to quit
   }
   // at this point all zmq objects had their destructor called
   std::cout << "  stopped. \n";
+
+  if (!RecordFile.empty() && pLive)
+  {
+    try
+    {
+      Record.save(RecordFile);
+      std::cout << "  recorded " << Record.size() << " ticks to " << RecordFile << "\n";
+    }
+    catch (const std::exception& e)
+    {
+      std::cout << e.what() << "\n";
+      return 1;
+    }
+  }
 }
 
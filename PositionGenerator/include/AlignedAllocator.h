@@ -0,0 +1,58 @@
+#pragma once
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+#include "HugePages.h"
+
+namespace PositionGenerator
+{
+	// default alignment for sensor data - one cache line, also wide enough for AVX-512 loads
+	constexpr std::size_t CacheLineSize = 64;
+
+	// minimal allocator that hands out memory aligned to Alignment bytes
+	// used for the columns of the sensor store, so vectorized loops can use aligned loads
+	// with MemoryPolicy::HugePages large blocks are mapped in huge pages, small ones still come from the heap
+	template <typename T, std::size_t Alignment = CacheLineSize>
+	class AlignedAllocator
+	{
+	public:
+		using value_type = T;
+		// containers keep the policy they were created with when moved or swapped
+		using propagate_on_container_move_assignment = std::true_type;
+		using propagate_on_container_swap = std::true_type;
+
+		template <typename U>
+		struct rebind { using other = AlignedAllocator<U, Alignment>; };
+
+		AlignedAllocator() = default;
+		explicit AlignedAllocator(MemoryPolicy policy) : m_Policy(policy) {}
+		template <typename U>
+		AlignedAllocator(const AlignedAllocator<U, Alignment>& Other) : m_Policy(Other.policy()) {}
+
+		T* allocate(std::size_t n)
+		{
+			if (usesHugePages(n))
+				return static_cast<T*>(allocateHugePages(n * sizeof(T)));
+			return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+		}
+
+		void deallocate(T* p, std::size_t n)
+		{
+			if (usesHugePages(n))
+				freeHugePages(p, n * sizeof(T));
+			else
+				::operator delete(p, std::align_val_t(Alignment));
+		}
+
+		MemoryPolicy policy() const { return m_Policy; }
+
+		template <typename U>
+		bool operator==(const AlignedAllocator<U, Alignment>& Other) const { return m_Policy == Other.policy(); }
+
+	private:
+		MemoryPolicy m_Policy = MemoryPolicy::Default;
+
+		bool usesHugePages(std::size_t n) const { return m_Policy == MemoryPolicy::HugePages && n * sizeof(T) >= MinHugePageAllocation; }
+	};
+}
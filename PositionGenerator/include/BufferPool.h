@@ -0,0 +1,82 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "HugePages.h"
+
+namespace PositionGenerator
+{
+	// pool of reference counted byte buffers for the publish path
+	// buffers go back to the pool when the last reference is released - this may happen on any thread,
+	// e.g. the zeromq I/O thread once it is done with a zero-copy message.
+	// After warm up acquire/release do not touch the heap anymore.
+	// The storage is not written on allocation, so its pages end up on the NUMA node of the thread filling it first
+	class BufferPool
+	{
+	public:
+		class Buffer
+		{
+		public:
+			uint8_t* data() { return m_Storage.get(); }
+			const uint8_t* data() const { return m_Storage.get(); }
+			std::size_t capacity() const { return m_Capacity; }
+
+			// number of bytes in use, maintained by the user of the buffer
+			std::size_t size() const { return m_Size; }
+			void setSize(std::size_t size) { m_Size = size; }
+
+			void addRef() { m_RefCount.fetch_add(1, std::memory_order_relaxed); }
+			void release();
+
+		private:
+			friend class BufferPool;
+			explicit Buffer(BufferPool* pPool) : m_pPool(pPool) {}
+
+			// frees the storage the way reserveStorage allocated it
+			struct StorageDeleter
+			{
+				StorageDeleter() : capacity(0), hugePages(false) {}
+				StorageDeleter(std::size_t capacity, bool hugePages) : capacity(capacity), hugePages(hugePages) {}
+				void operator()(uint8_t* p) const;
+
+				std::size_t capacity;
+				bool hugePages;
+			};
+
+			BufferPool* m_pPool;
+			std::unique_ptr<uint8_t[], StorageDeleter> m_Storage;
+			std::size_t m_Capacity = 0;
+			std::size_t m_Size = 0;
+			std::atomic<int> m_RefCount = 0;
+		};
+
+		// preallocates numBuffers buffers of bufferCapacity bytes, with MemoryPolicy::HugePages large buffers are
+		// mapped in huge pages
+		BufferPool(std::size_t numBuffers, std::size_t bufferCapacity, MemoryPolicy policy = MemoryPolicy::Default);
+		~BufferPool();
+		BufferPool(const BufferPool&) = delete;
+		BufferPool& operator=(const BufferPool&) = delete;
+
+		// returns a buffer with at least minCapacity bytes and a reference count of 1
+		// only allocates if the pool is exhausted or the free buffer is too small
+		Buffer* acquire(std::size_t minCapacity);
+
+		// number of heap allocations done by acquire(), stays constant in steady state
+		std::size_t numAllocations() const { return m_NumAllocations; }
+		std::size_t numFree() const;
+
+	private:
+		MemoryPolicy m_Policy;
+		mutable std::mutex m_Mutex;
+		std::vector<std::unique_ptr<Buffer>> m_Buffers;	// owns all buffers
+		std::vector<Buffer*> m_Free;
+		std::atomic<std::size_t> m_NumAllocations = 0;
+
+		void giveBack(Buffer* pBuffer);
+		void reserveStorage(Buffer& Buf, std::size_t capacity);
+	};
+}
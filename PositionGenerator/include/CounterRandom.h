@@ -0,0 +1,80 @@
+#pragma once
+#include <array>
+#include <cstdint>
+
+namespace PositionGenerator
+{
+	// Philox4x32-10 counter based random number generator (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3")
+	// the output is a pure function of counter and key, there is no sequential state
+	class Philox4x32
+	{
+	public:
+		using Counter_t = std::array<uint32_t, 4>;
+		using Key_t = std::array<uint32_t, 2>;
+
+		static Counter_t generate(Counter_t ctr, Key_t key)
+		{
+			for (int round = 0; round < 10; ++round)
+			{
+				if (round > 0)
+				{
+					key[0] += 0x9E3779B9u;
+					key[1] += 0xBB67AE85u;
+				}
+				const uint64_t prod0 = static_cast<uint64_t>(0xD2511F53u) * ctr[0];
+				const uint64_t prod1 = static_cast<uint64_t>(0xCD9E8D57u) * ctr[2];
+				ctr = Counter_t{
+					static_cast<uint32_t>(prod1 >> 32) ^ ctr[1] ^ key[0],
+					static_cast<uint32_t>(prod1),
+					static_cast<uint32_t>(prod0 >> 32) ^ ctr[3] ^ key[1],
+					static_cast<uint32_t>(prod0) };
+			}
+			return ctr;
+		}
+	};
+
+	// independent random streams used by the generator, each gets its own key
+	enum class RandomStream : uint32_t
+	{
+		Seed = 0,		// initial sensor placement
+		Motion = 1,	// random acceleration per tick
+		Noise = 2		// measurement noise
+	};
+
+	// random numbers keyed by (seed, sensorId, tick)
+	// any sensor's numbers can be computed on any thread in any order with identical results
+	class CounterRandom
+	{
+	public:
+		explicit CounterRandom(uint64_t seed = 0) : m_Seed(seed) {}
+
+		uint64_t seed() const { return m_Seed; }
+
+		// four uniform floats in [0,1)
+		std::array<float, 4> uniform(RandomStream stream, uint64_t sensorId, uint64_t tick) const
+		{
+			const Philox4x32::Counter_t ctr{
+				static_cast<uint32_t>(tick), static_cast<uint32_t>(tick >> 32),
+				static_cast<uint32_t>(sensorId), static_cast<uint32_t>(sensorId >> 32) };
+			const auto bits = Philox4x32::generate(ctr, key(stream));
+			return { toUnitFloat(bits[0]), toUnitFloat(bits[1]), toUnitFloat(bits[2]), toUnitFloat(bits[3]) };
+		}
+
+		// upper 24 bits - exactly representable in a float, result is strictly below 1
+		static float toUnitFloat(uint32_t bits) { return static_cast<float>(bits >> 8) * (1.f / 16777216.f); }
+
+		// Philox key of a stream, e.g. for the batched generation in uniformBatch()
+		Philox4x32::Key_t key(RandomStream stream) const
+		{
+			// splitmix64 finalizer, so neighbouring seeds and streams give unrelated keys
+			uint64_t z = m_Seed + (static_cast<uint64_t>(stream) + 1) * 0x9E3779B97F4A7C15ull;
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+			z = z ^ (z >> 31);
+			return { static_cast<uint32_t>(z), static_cast<uint32_t>(z >> 32) };
+		}
+
+	private:
+		uint64_t m_Seed;
+	};
+}
@@ -1,12 +1,34 @@
 #pragma once
 #include <chrono>
+#include <memory>
+#include <optional>
 #include <random>
+#include <span>
+#include <stdexcept>
 #include <vector>
 
+#include "CounterRandom.h"
+#include "HugePages.h"
+#include "MotionKernel.h"
 #include "Position.h"
+#include "SensorStore.h"
+#include "SharedSnapshot.h"
+#include "SlotMap.h"
+#include "SpatialGrid.h"
+#include "TickLog.h"
+#include "TickSnapshot.h"
+#include "UpdateWheel.h"
+#include "WorkerPool.h"
 
 namespace PositionGenerator
 {
+	// source of the random numbers used for movement and noise
+	enum class RandomPolicy
+	{
+		MersenneTwister,	// one shared sequential generator, sensors have to be processed in order
+		CounterBased			// Philox keyed by (seed, sensorId, tick), independent of processing order
+	};
+
 	class GenerationParameter
 	{
 	public:
@@ -20,6 +42,37 @@ namespace PositionGenerator
 		GenerationParameter& setInitialTimestamp(timestamp_t timestamp) { m_initialTimestamp = timestamp; return *this; }
 		GenerationParameter& setTimestampUnitPerSecond(uint64_t timestampUnitsPerSecond) { m_timeStampPerSecond = timestampUnitsPerSecond; return *this; }
 		GenerationParameter& setNoiseDimension(float noiseDimension) { m_NoiseDimension = noiseDimension; return *this; }
+		GenerationParameter& setRandomPolicy(RandomPolicy policy) { m_RandomPolicy = policy; return *this; }
+		// threads used by generateData, 1 runs on the calling thread only, 0 uses all hardware threads
+		// throws std::invalid_argument for negative counts
+		GenerationParameter& setNumOfThreads(int numOfThreads)
+		{
+			if (numOfThreads < 0)
+				throw std::invalid_argument("GenerationParameter: the number of threads can not be negative");
+			m_NumOfThreads = numOfThreads;
+			return *this;
+		}
+		// sensors per unit of work for the threads, a multiple of 16 keeps the vector kernel busy
+		GenerationParameter& setShardSize(int shardSize) { m_ShardSize = shardSize > 0 ? shardSize : 1; return *this; }
+		// fixed seed for all random numbers, without one the generator seeds itself from std::random_device
+		GenerationParameter& setSeed(uint64_t seed) { m_Seed = seed; return *this; }
+		// cell size of the spatial index kept up to date by generateData, 0 disables it
+		GenerationParameter& setGridCellSize(float cellSize) { m_GridCellSize = cellSize; return *this; }
+		// pairs of sensors closer than this are reported as proximity events each tick, 0 disables them
+		// needs the spatial index, which then uses the radius as cell size if none is set
+		GenerationParameter& setProximityRadius(float radius) { m_ProximityRadius = radius; return *this; }
+		// update rates in Hz, the sensors are split into ratesHz.size() groups of consecutive sensors, group k is
+		// updated at ratesHz[k] and generateData only moves the sensors due. Keeping a rate together keeps
+		// the memory touched per tick small, e.g. { 10, 10, 10, 200 } updates the last quarter at 200Hz
+		// empty (the default) updates every sensor on every generateData
+		GenerationParameter& setUpdateRates(std::vector<double> ratesHz) { m_UpdateRates = std::move(ratesHz); return *this; }
+		// room reserved for sensors added with Generator::addSensor, adding up to this many sensors does not allocate
+		GenerationParameter& setSensorCapacity(std::size_t capacity) { m_SensorCapacity = capacity; return *this; }
+		// memory of the sensor columns. With MemoryPolicy::HugePages and more than one thread the workers write the
+		// reserved columns (up to the sensor capacity) first, so a shard's pages tend to land on the NUMA node of the
+		// worker updating it. Best effort only: work stealing and unpinned threads move shards between nodes, and
+		// Windows large pages are committed at allocation, where the first touch places nothing
+		GenerationParameter& setMemoryPolicy(MemoryPolicy policy) { m_MemoryPolicy = policy; return *this; }
 
 		// read access to values
 		int numOfSensors() const { return m_NumOfSensors; }
@@ -29,6 +82,15 @@ namespace PositionGenerator
 		timestamp_t initialTimestamp() const { return m_initialTimestamp; }
 		uint64_t timeStampPerSecond() const { return m_timeStampPerSecond; }
 		float noiseDimension() const { return m_NoiseDimension; }
+		RandomPolicy randomPolicy() const { return m_RandomPolicy; }
+		int numOfThreads() const { return m_NumOfThreads; }
+		int shardSize() const { return m_ShardSize; }
+		const std::optional<uint64_t>& seed() const { return m_Seed; }
+		float gridCellSize() const { return m_GridCellSize; }
+		float proximityRadius() const { return m_ProximityRadius; }
+		const std::vector<double>& updateRates() const { return m_UpdateRates; }
+		std::size_t sensorCapacity() const { return m_SensorCapacity; }
+		MemoryPolicy memoryPolicy() const { return m_MemoryPolicy; }
 
 	private:
 		int			m_NumOfSensors = 10; 
@@ -38,32 +100,156 @@ namespace PositionGenerator
 		float		m_NoiseDimension = 0.3f;
 		timestamp_t m_initialTimestamp = 0;
 		uint64_t m_timeStampPerSecond = 1000*1000; // mikroseconds to seconds
+		RandomPolicy m_RandomPolicy = RandomPolicy::MersenneTwister;
+		int m_NumOfThreads = 1;
+		int m_ShardSize = 16 * 1024;
+		std::optional<uint64_t> m_Seed;
+		float m_GridCellSize = 0.f;
+		float m_ProximityRadius = 0.f;
+		std::vector<double> m_UpdateRates;
+		std::size_t m_SensorCapacity = 0;
+		MemoryPolicy m_MemoryPolicy = MemoryPolicy::Default;
+	};
+
+	// two sensors within the proximity radius of each other at the current tick, first < second
+	struct ProximityEvent
+	{
+		sensorId_t first;
+		sensorId_t second;
+		float distance;
 	};
 
 	class Generator
 	{
 	public:
-		using SensorList_t = std::vector<SensorPosition>;
+		using SensorList_t = SensorStore;
 		Generator(const GenerationParameter& Param);
 
 		// allow iterating on the sensors as primary interface to them
-		SensorList_t::const_iterator begin() { return m_Sensors.cbegin(); }
-		SensorList_t::const_iterator end() { return m_Sensors.cend(); }
+		// only on the thread calling generateData, other threads read the snapshots of publishSnapshot
+		SensorList_t::const_iterator begin() const { return m_Sensors.begin(); }
+		SensorList_t::const_iterator end() const { return m_Sensors.end(); }
+		const SensorList_t& sensors() const { return m_Sensors; }
+		const GenerationParameter& parameter() const { return m_Param; }
 
+		// advances the sensors to newTimestamp, with update rates only the ones due at newTimestamp
 		void generateData(timestamp_t newTimestamp);
+		// sensors entering and leaving while the generator runs, only between generateData calls
+		// the ids stay valid until the sensor is removed and are never handed out again. A new sensor starts at a
+		// random position with the current timestamp, with update rates it is updated at updateRateHz
+		// (0 takes the first rate of the parameter). Removing moves the last sensor into the gap, so the columns
+		// stay dense and both are O(1). Both invalidate updatedSensors() and grid() until the next generateData.
+		// A replay only contains the initial sensors, so both throw std::logic_error while recordTo records.
+		// addSensor throws std::invalid_argument for a negative or non-finite rate, or any rate other than 0 without
+		// update rates, and leaves the generator unchanged then
+		sensorId_t addSensor(double updateRateHz = 0.);
+		// false if no sensor has this id
+		bool removeSensor(sensorId_t sensorId);
+		// index into sensors() of a sensor
+		std::optional<std::size_t> indexOf(sensorId_t sensorId) const;
+		// room for numSensors sensors, so addSensor does not reallocate below it
+		void reserveSensors(std::size_t numSensors);
+
+		// timestamp of the last generateData call (initial timestamp before)
+		timestamp_t currentTimestamp() const { return m_CurrentTimestamp; }
+		// instruction set the motion kernel uses on this machine
+		SimdLevel simdLevel() const { return m_SimdLevel; }
+		// seed in use, the parameter's seed or the one drawn from std::random_device
+		uint64_t seed() const { return m_Seed; }
+		// empty log with the seed, time base and parameters of this generator, for recording its ticks
+		TickLog emptyTickLog() const;
 		Vector3 addNoise(const Vector3& origPosition);
+		// noise for a sensor, with the counter based policy the result only depends on sensorId and timestamp
+		Vector3 addNoise(const SensorPosition& Sensor);
+		// noise for many positions at once, In and Out have the same size (and may be the same buffer)
+		// gives the same results as calling addNoise for every position in order
+		// throws std::invalid_argument if the sizes differ
+		void addNoise(std::span<const Vector3> In, std::span<Vector3> Out);
+
+		// copies the current state of all sensors with noise applied, e.g. to hand it to another thread
+		void captureSnapshot(TickSnapshot& Snapshot);
+		void captureSnapshot(const SnapshotColumns& Columns);
+		// captures the current state into the next buffer of Shared and publishes it for the readers of Shared
+		// false if the tick was skipped because readers still hold all spare buffers
+		bool publishSnapshot(SharedSnapshot& Shared);
+		// like captureSnapshot, but only the sensors moved by the last generateData
+		// without update rates these are all sensors
+		void captureUpdates(TickSnapshot& Snapshot);
+
+		// dead reckoning, moves a sensor along its last velocity from its last update to timestamp and keeps it
+		// inside the bounding cuboid. Between the previous and the last update of the sensor this interpolates its
+		// two positions, later it extrapolates. No noise is applied and the generator is not changed,
+		// so sampling more often than generateData runs does not alter the generated data
+		// must not run concurrently with generateData
+		Vector3 estimatePosition(std::size_t index, timestamp_t timestamp) const;
+		// the same for the sensors [first, last), element i of the columns is sensor first + i
+		// the columns need room for last - first sensors, all get timestamp as their timestamp
+		void estimatePositions(std::size_t first, std::size_t last, timestamp_t timestamp, const SnapshotColumns& Out) const;
+
+		bool hasUpdateRates() const { return m_pWheel != nullptr; }
+		// indices into sensors() of the sensors moved by the last generateData, only filled with update rates
+		std::span<const UpdateWheel::index_t> updatedSensors() const { return m_Updated; }
+		// timestamp units between two updates of a sensor, 0 without update rates
+		timestamp_t updatePeriod(std::size_t index) const { return m_pWheel ? m_UpdatePeriods[index] : 0; }
+
+		// spatial index over the positions (without noise), the entries are indices into sensors()
+		// nullptr unless a grid cell size or a proximity radius is set, or after sensors were added or removed
+		const SpatialGrid* grid() const { return m_GridStale ? nullptr : m_pGrid.get(); }
+		// all pairs of sensors within the proximity radius after the last generateData
+		const std::vector<ProximityEvent>& proximityEvents() const { return m_ProximityEvents; }
+
+	protected:
+		// set while the ticks are recorded, the sensors have to stay the ones a replay creates
+		bool m_Recording = false;
 
 	private:
 		std::random_device m_Rnd;
+		uint64_t m_Seed;
 		std::mt19937 m_Gen;
 		std::uniform_real_distribution<float> m_DistanceDist; // 0 <= v < 1
+		CounterRandom m_CounterRandom;
+		uint64_t m_NoiseCounter = 0; // counter for noise requests without sensor
 		GenerationParameter m_Param;
-		std::vector<SensorPosition> m_Sensors;
+		SensorList_t m_Sensors;
+		SlotMap m_Ids;	// sensor id to index into m_Sensors
+		timestamp_t m_CurrentTimestamp;
+		MotionLimits m_Limits;
+		SimdLevel m_SimdLevel;
 
-		void generateNewSensorData(SensorPosition& Sensor, timestamp_t newTimestamp);
-		void generateWithImpulse(SensorPosition& Sensor, timestamp_t newTimestamp);
-		void clamp(Vector3& Pos);
+		// per sensor scratch data for the batched motion kernel
+		SensorStore::Column_t<float> m_TimeInSec;
+		SensorStore::Column_t<float> m_RandAcc;
+		SensorStore::Column_t<float> m_RandDirX;
+		SensorStore::Column_t<float> m_RandDirY;
+
+		// only created for more than one thread
+		std::unique_ptr<WorkerPool> m_pWorkers;
+
+		std::unique_ptr<SpatialGrid> m_pGrid;
+		bool m_GridStale = false;	// sensors were added or removed since the grid was built
+		std::vector<ProximityEvent> m_ProximityEvents;
+
+		// only created with update rates
+		std::unique_ptr<UpdateWheel> m_pWheel;
+		std::vector<timestamp_t> m_UpdatePeriods;
+		std::vector<UpdateWheel::index_t> m_Updated;
+
+		void generateWithImpulse(std::size_t first, std::size_t last, timestamp_t newTimestamp);
+		void drawImpulses(std::size_t first, std::size_t last, timestamp_t newTimestamp);
+		void moveSensors(std::size_t first, std::size_t last);
+		void generateDue(timestamp_t newTimestamp);
+		void moveUpdated(std::size_t first, std::size_t last, timestamp_t newTimestamp);
 		void seedSensors();
+		void placeSensors(std::size_t capacity);
+		Vector3 randomPosition(sensorId_t sensorId, timestamp_t timestamp);
+		void scheduleUpdates();
+		timestamp_t updatePeriodOf(double rateHz) const;
+		void sensorsChanged();
+		void updateGrid(bool cellsComputed);
+		void updateProximity();
+		Vector3 noisyPosition(const Vector3& origPosition, float intensity, float dirX, float dirY) const;
+		void noiseColumns(std::size_t count, const sensorId_t* sensorIds, const timestamp_t* ticks,
+			const float* inX, const float* inY, float* outX, float* outY);
 	};
 
 	// now specialize to use chrono timestamps
@@ -73,7 +259,30 @@ namespace PositionGenerator
 		ChronoBasedGenerator(const GenerationParameter& Param);
 		void generateData();
 	
+		// appends the timestamp of every generated tick to Log, nullptr stops recording
+		// Log has to outlive the recording
+		void recordTo(TickLog* pLog);
+
 	private: 
 		std::chrono::high_resolution_clock::time_point m_Start;
+		TickLog* m_pRecord = nullptr;
+	};
+
+	// replays the ticks of a recorded run, seed and time base are taken from the log
+	class ReplayGenerator : public Generator
+	{
+	public:
+		// throws std::invalid_argument if Param would generate other data than the recorded run
+		// (threads, shards, spatial index and memory policy may differ)
+		ReplayGenerator(const GenerationParameter& Param, TickLog Log);
+
+		// generates the next recorded tick, false once all ticks were replayed
+		bool generateData();
+		bool finished() const { return m_NextTick >= m_Log.size(); }
+		const TickLog& log() const { return m_Log; }
+
+	private:
+		TickLog m_Log;
+		std::size_t m_NextTick = 0;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,25 @@
+#pragma once
+#include <cstddef>
+
+namespace PositionGenerator
+{
+	// where the large per sensor arrays get their memory from
+	enum class MemoryPolicy
+	{
+		Default,		// the heap
+		HugePages		// mapped directly in 2MB huge pages where the OS allows, fewer TLB misses for millions of sensors
+	};
+
+	constexpr std::size_t HugePageSize = 2 * 1024 * 1024;
+
+	// allocations smaller than this stay on the heap even with MemoryPolicy::HugePages
+	constexpr std::size_t MinHugePageAllocation = HugePageSize / 2;
+
+	// maps at least bytes, aligned to HugePageSize, throws std::bad_alloc
+	// Linux: anonymous mapping advised for transparent huge pages. The pages are not touched, the kernel places
+	// each one on the NUMA node of the thread writing it first. Windows: large pages if the process holds the
+	// lock pages privilege, regular pages otherwise
+	void* allocateHugePages(std::size_t bytes);
+	// bytes as passed to allocateHugePages
+	void freeHugePages(void* p, std::size_t bytes);
+}
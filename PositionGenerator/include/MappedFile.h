@@ -0,0 +1,47 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace PositionGenerator
+{
+	// file mapped into memory (mmap / MapViewOfFile), unmapped on destruction
+	// errors throw std::runtime_error
+	class MappedFile
+	{
+	public:
+		MappedFile() = default;
+		~MappedFile();
+		MappedFile(MappedFile&& Other) noexcept;
+		MappedFile& operator=(MappedFile&& Other) noexcept;
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		// creates (or truncates) fileName with size bytes and maps it writable
+		static MappedFile create(const std::string& fileName, std::size_t size);
+		// maps an existing file read only
+		static MappedFile openReadOnly(const std::string& fileName);
+
+		uint8_t* data() { return m_pData; }
+		const uint8_t* data() const { return m_pData; }
+		std::size_t size() const { return m_Size; }
+		bool isOpen() const { return m_pData != nullptr; }
+
+		// tells the os that the mapping is read front to back, so it reads ahead aggressively
+		void adviseSequential();
+		// writes modified pages back to the file
+		void flush();
+		void close();
+
+	private:
+		uint8_t* m_pData = nullptr;
+		std::size_t m_Size = 0;
+		bool m_Writable = false;
+#if defined(_WIN32)
+		void* m_hFile = nullptr;
+		void* m_hMapping = nullptr;
+#else
+		int m_Fd = -1;
+#endif
+	};
+}
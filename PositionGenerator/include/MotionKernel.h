@@ -0,0 +1,85 @@
+#pragma once
+#include <cstddef>
+
+#include "CounterRandom.h"
+#include "Position.h"
+
+namespace PositionGenerator
+{
+	// instruction set used by the batched motion kernel
+	enum class SimdLevel
+	{
+		Scalar,
+		AVX2,		// 8 sensors per instruction
+		AVX512	// 16 sensors per instruction
+	};
+
+	// highest level supported by the cpu we are running on (cpuid based, evaluated once)
+	SimdLevel detectSimdLevel();
+	bool isSimdLevelSupported(SimdLevel level);
+	const char* simdLevelName(SimdLevel level);
+
+	// constant parameters of the motion model
+	struct MotionLimits
+	{
+		float maxVelocity = 0.f;
+		Vector3 minValues;
+		Vector3 maxValues;
+	};
+
+	// one batch of sensors for the motion kernel, all arrays hold count elements
+	// the random numbers have to be drawn beforehand, all are expected in [0,1)
+	struct MotionBatch
+	{
+		std::size_t count = 0;
+		const float* timeInSec = nullptr;	// elapsed time since last update per sensor
+		const float* randAcc = nullptr;		// scale of the random acceleration
+		const float* randDirX = nullptr;	// direction of the random acceleration
+		const float* randDirY = nullptr;
+		float* posX = nullptr;
+		float* posY = nullptr;
+		float* posZ = nullptr;
+		float* veloX = nullptr;
+		float* veloY = nullptr;
+		float* veloZ = nullptr;
+	};
+
+	// advances all sensors of the batch by one step of the random impulse model
+	// all levels produce bit identical results, the vector paths only process more sensors at once
+	void advanceSensors(const MotionBatch& Batch, const MotionLimits& Limits);
+	void advanceSensors(const MotionBatch& Batch, const MotionLimits& Limits, SimdLevel level);
+
+	// measurement noise for a batch of positions, all arrays hold count elements
+	// moves x/y by up to noiseDimension in a random direction, z is not affected
+	struct NoiseBatch
+	{
+		std::size_t count = 0;
+		float noiseDimension = 0.f;
+		const float* randIntensity = nullptr;	// fraction of noiseDimension, in [0,1)
+		const float* randDirX = nullptr;			// direction of the noise, in [0,1)
+		const float* randDirY = nullptr;
+		const float* posX = nullptr;
+		const float* posY = nullptr;
+		float* outX = nullptr;	// may be the same as posX
+		float* outY = nullptr;
+	};
+
+	// bit identical on all levels, like advanceSensors
+	void applyNoise(const NoiseBatch& Batch, SimdLevel level);
+
+	// counter based random numbers for a batch of sensors
+	// element i gets the first three values of CounterRandom::uniform(stream, sensorIds[i], ticks[i]) for the key of that stream
+	struct RandomBatch
+	{
+		std::size_t count = 0;
+		Philox4x32::Key_t key{};
+		const uint64_t* sensorIds = nullptr;
+		const uint64_t* ticks = nullptr;
+		float* out0 = nullptr;
+		float* out1 = nullptr;
+		float* out2 = nullptr;
+	};
+
+	// Philox rounds run on 8 (AVX2) or 16 (AVX-512) counters at once
+	void uniformBatch(const RandomBatch& Batch, SimdLevel level);
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+#include "SensorStore.h"
+#include "TickSnapshot.h"
+
+namespace PositionGenerator
+{
+	// positions in fixed point, either absolute (keyframe) or as difference to the previous tick of the same sensor
+	// the small integers pack into one or two bytes as zigzag varints, instead of twelve bytes for three floats
+	struct EncodedTick
+	{
+		bool keyframe = true;
+		float resolution = 0.f;				// meters per step, position = quantized value * resolution
+		timestamp_t tickTimestamp = 0;
+		SensorStore::Column_t<sensorId_t> sensorIds;
+		SensorStore::Column_t<int64_t> timestampOffsets;	// sensor timestamp - tick timestamp, 0 for generated ticks
+		SensorStore::Column_t<int32_t> x;
+		SensorStore::Column_t<int32_t> y;
+		SensorStore::Column_t<int32_t> z;
+
+		std::size_t size() const { return sensorIds.size(); }
+
+		// keeps the capacity, like TickSnapshot::resize
+		void resize(std::size_t numSensors)
+		{
+			sensorIds.resize(numSensors);
+			timestampOffsets.resize(numSensors);
+			x.resize(numSensors);
+			y.resize(numSensors);
+			z.resize(numSensors);
+		}
+	};
+
+	// quantizes snapshots to a fixed resolution and codes every tick but the keyframes as delta to the previous one
+	// The deltas are taken per sensor against its previously sent quantized values, so the decoded positions never
+	// drift further than half a step from the real ones, and a tick may hold any subset of the sensors (e.g. only
+	// the ones due with update rates). A tick becomes a keyframe on the first tick, when it holds a sensor never
+	// sent before, or when one of its sensors was sent keyframeInterval times since its last keyframe.
+	// So every sensor is sent absolute at least every keyframeInterval updates and a late subscriber can sync up.
+	class PositionEncoder
+	{
+	public:
+		// resolution in meters per step, keyframeInterval 0 or 1 sends keyframes only
+		explicit PositionEncoder(float resolution = 0.001f, uint32_t keyframeInterval = 50);
+
+		float resolution() const { return m_Resolution; }
+		uint32_t keyframeInterval() const { return m_KeyframeInterval; }
+
+		// positions beyond the int32 range of steps saturate, NaN is coded as the lowest value
+		void encode(const TickSnapshot& Snapshot, EncodedTick& Out);
+		// the next encode sends a keyframe
+		void forceKeyframe() { m_ForceKeyframe = true; }
+
+	private:
+		float m_Resolution;
+		float m_InvResolution;
+		uint32_t m_KeyframeInterval;
+		bool m_ForceKeyframe = true;
+
+		// every sensor ever sent has a slot, like the decoder the slots of removed sensors are kept
+		std::unordered_map<sensorId_t, uint32_t> m_Slots;
+		// last sent quantized values and deltas sent since the last keyframe, by slot
+		SensorStore::Column_t<int32_t> m_X;
+		SensorStore::Column_t<int32_t> m_Y;
+		SensorStore::Column_t<int32_t> m_Z;
+		SensorStore::Column_t<uint32_t> m_SinceKeyframe;
+
+		// sensors of the previous tick and their slots, ticks with the same sensors skip the lookups
+		SensorStore::Column_t<sensorId_t> m_SensorIds;
+		SensorStore::Column_t<uint32_t> m_TickSlots;
+
+		bool sameSensors(const TickSnapshot& Snapshot) const;
+		// looks up the slots of the snapshot's sensors, true if one of them got a new slot
+		bool assignSlots(const TickSnapshot& Snapshot);
+	};
+
+	// subscriber side: restores the positions, the encoded tick may be any part of a tick (one frame of it)
+	class PositionDecoder
+	{
+	public:
+		// appends the sensors of Tick to Out, returns false if a delta refers to a sensor without keyframe yet
+		// those sensors are skipped, all others are decoded
+		bool decode(const EncodedTick& Tick, TickSnapshot& Out);
+
+		void reset() { m_Last.clear(); }
+
+	private:
+		struct Quantized
+		{
+			int32_t x, y, z;
+		};
+		std::unordered_map<sensorId_t, Quantized> m_Last;
+	};
+}
@@ -0,0 +1,126 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "MappedFile.h"
+#include "Position.h"
+#include "TickSnapshot.h"
+
+namespace PositionGenerator
+{
+	class Generator;
+
+	// binary dataset of pre-generated ticks (little endian, all offsets from the start of the file)
+	//   DatasetHeader
+	//   TickIndexEntry[maxTicks]
+	//   one block per tick, each holding the columns sensorId, timestamp, x, y, z for numSensors records
+	// all columns start on a cache line, so they can be used in place from the mapping
+	constexpr char DatasetMagic[8] = { 'P', 'G', 'D', 'A', 'T', 'A', '0', '1' };
+	constexpr uint32_t DatasetVersion = 1;
+
+	enum class DatasetColumn : uint32_t
+	{
+		SensorId = 0,	// uint64
+		Timestamp,		// uint64
+		X,						// float
+		Y,						// float
+		Z,						// float
+		Count
+	};
+
+	struct DatasetHeader
+	{
+		char magic[8];
+		uint32_t version;
+		uint32_t headerSize;
+		uint64_t numSensors;			// records per tick
+		uint64_t numTicks;				// ticks written, the index has room for maxTicks
+		uint64_t maxTicks;
+		uint64_t timestampUnitsPerSecond;
+		uint64_t seed;						// seed of the generator that produced the data
+		uint64_t indexOffset;
+		uint64_t dataOffset;			// first tick block
+		uint64_t blockSize;				// bytes per tick block, a multiple of the cache line size
+		uint64_t columnOffset[static_cast<std::size_t>(DatasetColumn::Count)];	// relative to the tick block
+		uint8_t reserved[8];
+	};
+	static_assert(sizeof(DatasetHeader) == 128, "the header is part of the file format");
+
+	struct TickIndexEntry
+	{
+		timestamp_t tickTimestamp;
+		uint64_t offset;			// of the tick block
+		uint64_t numRecords;
+		uint64_t reserved;
+	};
+	static_assert(sizeof(TickIndexEntry) == 32, "the index is part of the file format");
+
+	// fills header fields that only depend on the number of sensors and ticks
+	DatasetHeader makeDatasetHeader(std::size_t numSensors, std::size_t maxTicks);
+
+	// writes ticks straight into a mapped file, the file has its final size from the start
+	class DatasetWriter
+	{
+	public:
+		DatasetWriter(const std::string& fileName, std::size_t numSensors, std::size_t maxTicks,
+			uint64_t timestampUnitsPerSecond, uint64_t seed);
+		~DatasetWriter();
+		DatasetWriter(const DatasetWriter&) = delete;
+		DatasetWriter& operator=(const DatasetWriter&) = delete;
+
+		// columns of the next tick block, to be filled by the caller (e.g. Generator::captureSnapshot)
+		// throws std::length_error once maxTicks ticks were written
+		SnapshotColumns appendTick(timestamp_t tickTimestamp);
+
+		std::size_t numTicks() const { return header().numTicks; }
+		std::size_t maxTicks() const { return header().maxTicks; }
+
+		// flushes the mapping and closes the file, called by the destructor as well
+		void close();
+
+	private:
+		MappedFile m_File;
+
+		DatasetHeader& header() { return *reinterpret_cast<DatasetHeader*>(m_File.data()); }
+		const DatasetHeader& header() const { return *reinterpret_cast<const DatasetHeader*>(m_File.data()); }
+	};
+
+	// one tick of a mapped dataset, all pointers point into the mapping
+	struct DatasetTick
+	{
+		timestamp_t tickTimestamp = 0;
+		std::size_t numRecords = 0;
+		const TickIndexEntry* pIndexEntry = nullptr;
+		const uint8_t* pBlock = nullptr;	// all columns of the tick
+		std::size_t blockSize = 0;
+		const sensorId_t* sensorIds = nullptr;
+		const timestamp_t* timestamps = nullptr;
+		const float* x = nullptr;
+		const float* y = nullptr;
+		const float* z = nullptr;
+	};
+
+	// maps a dataset read only and walks its tick index
+	// the constructor validates header and index against the file size and throws std::runtime_error if they do not match
+	class DatasetReader
+	{
+	public:
+		explicit DatasetReader(const std::string& fileName);
+
+		const DatasetHeader& header() const { return *reinterpret_cast<const DatasetHeader*>(m_File.data()); }
+		std::size_t numTicks() const { return header().numTicks; }
+		std::size_t numSensors() const { return header().numSensors; }
+		// index < numTicks()
+		DatasetTick tick(std::size_t index) const;
+
+	private:
+		MappedFile m_File;
+
+		const TickIndexEntry* index() const { return reinterpret_cast<const TickIndexEntry*>(m_File.data() + header().indexOffset); }
+	};
+
+	// runs Gen for numTicks ticks of tickInterval timestamp units as fast as possible and stores every tick
+	// returns the number of bytes of the dataset
+	std::size_t generateDataset(Generator& Gen, const std::string& fileName, std::size_t numTicks, timestamp_t tickInterval);
+}
@@ -0,0 +1,128 @@
+#pragma once
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <vector>
+
+#include "AlignedAllocator.h"
+#include "Position.h"
+
+namespace PositionGenerator
+{
+	// structure-of-arrays storage for the sensors of a generator
+	// every attribute lives in its own contiguous, cache line aligned column, so the update loop
+	// streams linearly through memory and can be vectorized.
+	// Iteration still hands out SensorPosition values, so users do not need to know about the layout
+	class SensorStore
+	{
+	public:
+		template <typename T>
+		using Column_t = std::vector<T, AlignedAllocator<T>>;
+
+		// proxy iterator - dereferencing assembles a SensorPosition from the columns
+		class const_iterator
+		{
+		public:
+			using iterator_concept = std::random_access_iterator_tag;
+			using iterator_category = std::input_iterator_tag;
+			using value_type = SensorPosition;
+			using difference_type = std::ptrdiff_t;
+			using reference = SensorPosition;
+			using pointer = void;
+
+			const_iterator() = default;
+			const_iterator(const SensorStore* pStore, std::size_t index) : m_pStore(pStore), m_Index(index) {}
+
+			SensorPosition operator*() const { return m_pStore->at(m_Index); }
+			SensorPosition operator[](difference_type offset) const { return m_pStore->at(m_Index + offset); }
+
+			const_iterator& operator++() { ++m_Index; return *this; }
+			const_iterator operator++(int) { auto old = *this; ++m_Index; return old; }
+			const_iterator& operator--() { --m_Index; return *this; }
+			const_iterator operator--(int) { auto old = *this; --m_Index; return old; }
+			const_iterator& operator+=(difference_type offset) { m_Index += offset; return *this; }
+			const_iterator& operator-=(difference_type offset) { m_Index -= offset; return *this; }
+
+			friend const_iterator operator+(const_iterator it, difference_type offset) { return it += offset; }
+			friend const_iterator operator+(difference_type offset, const_iterator it) { return it += offset; }
+			friend const_iterator operator-(const_iterator it, difference_type offset) { return it -= offset; }
+			friend difference_type operator-(const const_iterator& First, const const_iterator& Second)
+			{
+				return static_cast<difference_type>(First.m_Index) - static_cast<difference_type>(Second.m_Index);
+			}
+
+			bool operator==(const const_iterator& Other) const { return m_Index == Other.m_Index; }
+			auto operator<=>(const const_iterator& Other) const { return m_Index <=> Other.m_Index; }
+
+			std::size_t index() const { return m_Index; }
+
+		private:
+			const SensorStore* m_pStore = nullptr;
+			std::size_t m_Index = 0;
+		};
+
+		SensorStore() = default;
+		// columns allocated following policy
+		explicit SensorStore(MemoryPolicy policy);
+
+		const_iterator begin() const { return const_iterator(this, 0); }
+		const_iterator end() const { return const_iterator(this, size()); }
+
+		std::size_t size() const { return m_SensorIds.size(); }
+		bool empty() const { return m_SensorIds.empty(); }
+		void reserve(std::size_t capacity);
+		void clear();
+		// writes the reserved but unused storage of sensors [first, last) once from the calling thread, so the OS
+		// backs these pages with memory of the NUMA node this thread runs on. Only has an effect on pages not
+		// touched before, i.e. right after reserve with MemoryPolicy::HugePages. Existing sensors are not changed
+		void touchCapacity(std::size_t first, std::size_t last);
+		template <typename T>
+		static void touchCapacity(Column_t<T>& Column, std::size_t first, std::size_t last);
+
+		void push_back(const SensorPosition& Sensor);
+		// moves the last sensor to index and drops the last, O(1) but changes the order
+		void eraseUnordered(std::size_t index);
+		SensorPosition at(std::size_t index) const;
+		void set(std::size_t index, const SensorPosition& Sensor);
+
+		// direct column access for the update loops
+		const sensorId_t* sensorIds() const { return m_SensorIds.data(); }
+		const timestamp_t* timestamps() const { return m_Timestamps.data(); }
+		const float* posX() const { return m_PosX.data(); }
+		const float* posY() const { return m_PosY.data(); }
+		const float* posZ() const { return m_PosZ.data(); }
+		const float* veloX() const { return m_VeloX.data(); }
+		const float* veloY() const { return m_VeloY.data(); }
+		const float* veloZ() const { return m_VeloZ.data(); }
+
+		timestamp_t* timestamps() { return m_Timestamps.data(); }
+		float* posX() { return m_PosX.data(); }
+		float* posY() { return m_PosY.data(); }
+		float* posZ() { return m_PosZ.data(); }
+		float* veloX() { return m_VeloX.data(); }
+		float* veloY() { return m_VeloY.data(); }
+		float* veloZ() { return m_VeloZ.data(); }
+
+	private:
+		Column_t<sensorId_t>	m_SensorIds;
+		Column_t<timestamp_t>	m_Timestamps;
+		Column_t<float>				m_PosX;
+		Column_t<float>				m_PosY;
+		Column_t<float>				m_PosZ;
+		Column_t<float>				m_VeloX;
+		Column_t<float>				m_VeloY;
+		Column_t<float>				m_VeloZ;
+	};
+
+	template <typename T>
+	void SensorStore::touchCapacity(Column_t<T>& Column, std::size_t first, std::size_t last)
+	{
+		// the storage beyond size() is raw memory, writing it does not create elements
+		first = std::max(first, Column.size());
+		last = std::min(last, Column.capacity());
+		if (first < last)
+			std::memset(static_cast<void*>(Column.data() + first), 0, (last - first) * sizeof(T));
+	}
+}
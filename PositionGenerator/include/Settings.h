@@ -0,0 +1,53 @@
+#pragma once
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "Generator.h"
+#include "Position.h"
+
+namespace PositionGenerator
+{
+	// settings of a run as key/value pairs, read from config files and the command line
+	// config file: one "key = value" per line, '#' starts a comment; command line: "--key value"
+	// a later value overrides an earlier one, "--config <file>" loads the file at its position on the command line,
+	// so options after it win over the file
+	// the typed getters throw std::invalid_argument naming the key if a value does not parse
+	class Settings
+	{
+	public:
+		// throws std::runtime_error if the file can not be read or has a line without '='
+		void loadFile(const std::string& fileName);
+		void parseCommandLine(int argc, const char* const argv[]);
+		void set(const std::string& key, const std::string& value) { m_Values[key] = value; }
+
+		bool has(const std::string& key) const { return m_Values.count(key) > 0; }
+		std::string getString(const std::string& key, const std::string& defaultValue) const;
+		double getDouble(const std::string& key, double defaultValue) const;
+		int64_t getInt(const std::string& key, int64_t defaultValue) const;
+		uint64_t getUInt(const std::string& key, uint64_t defaultValue) const;
+		// true/false, yes/no, on/off or 1/0
+		bool getBool(const std::string& key, bool defaultValue) const;
+		// three comma separated numbers "x,y,z"
+		Vector3 getVector(const std::string& key, const Vector3& defaultValue) const;
+		// any number of comma separated numbers
+		std::vector<double> getList(const std::string& key, const std::vector<double>& defaultValue) const;
+
+		// keys that were set but never read, most likely typos
+		std::vector<std::string> unusedKeys() const;
+
+	private:
+		std::map<std::string, std::string> m_Values;
+		mutable std::set<std::string> m_Used;
+
+		const std::string* find(const std::string& key) const;
+	};
+
+	// all GenerationParameter fields from Settings, keys that are not set keep the values of Defaults:
+	// sensors, min, max, max-velocity, initial-timestamp, timestamp-units-per-second, noise,
+	// random (mersenne or philox), threads, shard-size, seed, grid-cell-size, proximity-radius, update-rates,
+	// memory (default or huge-pages)
+	GenerationParameter generationParameter(const Settings& Config, const GenerationParameter& Defaults = GenerationParameter());
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "AlignedAllocator.h"
+#include "TickSnapshot.h"
+
+namespace PositionGenerator
+{
+	// latest TickSnapshot of one writer thread, shared with any number of reader threads
+	// The writer fills a spare buffer and publishes it with one atomic exchange, readers keep the snapshot they
+	// acquired unchanged until they release it (read-copy-update with a few buffers instead of copies).
+	// Acquiring and releasing are a single atomic add each: the reader count of the current buffer lives in the
+	// same word as its index, so a reader gets the buffer and counts itself in one step and never retries.
+	// The writer never waits for readers, if every spare buffer is still read it skips the publish.
+	class SharedSnapshot
+	{
+	public:
+		class Reader
+		{
+		public:
+			Reader() = default;
+			Reader(Reader&& Other) noexcept : m_pOwner(Other.m_pOwner), m_buffer(Other.m_buffer) { Other.m_pOwner = nullptr; }
+			Reader& operator=(Reader&& Other) noexcept;
+			~Reader() { release(); }
+
+			// false before the first publish
+			explicit operator bool() const { return m_pOwner != nullptr; }
+			const TickSnapshot& operator*() const { return m_pOwner->m_Buffers[m_buffer].Snapshot; }
+			const TickSnapshot* operator->() const { return &**this; }
+			// number of the publish that made this snapshot current, counts from 1
+			uint64_t epoch() const { return m_pOwner->m_Buffers[m_buffer].epoch; }
+
+			void release();
+
+		private:
+			friend class SharedSnapshot;
+			Reader(const SharedSnapshot* pOwner, std::size_t buffer) : m_pOwner(pOwner), m_buffer(buffer) {}
+
+			const SharedSnapshot* m_pOwner = nullptr;
+			std::size_t m_buffer = 0;
+		};
+
+		// at least 2 buffers, with 3 the writer always finds a spare one as long as readers release
+		// their snapshot before the next but one publish
+		explicit SharedSnapshot(std::size_t numBuffers = 3);
+		SharedSnapshot(const SharedSnapshot&) = delete;
+		SharedSnapshot& operator=(const SharedSnapshot&) = delete;
+
+		// writer side, only one thread
+		// buffer for the next publish, nullptr if all spare buffers are still read
+		// the buffer keeps its content and capacity from its last use
+		TickSnapshot* writeBuffer();
+		// makes the buffer of writeBuffer the current snapshot, false if there was none
+		bool publish();
+		uint64_t numPublished() const { return m_Epoch; }
+		uint64_t numSkipped() const { return m_Skipped; }
+
+		// reader side, any thread, wait-free
+		// the returned snapshot stays valid and unchanged until the Reader is released or destroyed
+		Reader acquire() const;
+
+	private:
+		// index of the current buffer in the upper bits, readers that acquired it in the lower bits
+		static constexpr unsigned IndexShift = 48;
+		static constexpr uint64_t CountMask = (uint64_t(1) << IndexShift) - 1;
+		static constexpr uint64_t NoBuffer = 0xFFFF;
+
+		struct alignas(CacheLineSize) Buffer
+		{
+			// readers that released the buffer (negative) plus the ones handed over by the writer
+			// zero once the buffer is no longer current and nobody reads it
+			std::atomic<int64_t> readers = 0;
+			uint64_t epoch = 0;
+			TickSnapshot Snapshot;
+		};
+
+		alignas(CacheLineSize) mutable std::atomic<uint64_t> m_Current = NoBuffer << IndexShift;
+		std::unique_ptr<Buffer[]> m_Buffers;
+		std::size_t m_NumBuffers;
+		std::size_t m_Writing = NoBuffer;
+		uint64_t m_Epoch = 0;
+		uint64_t m_Skipped = 0;
+	};
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace PositionGenerator
+{
+	// stable 64 bit ids for the entries of a dense array whose entries move when others are removed
+	// An id is the slot number in the lower and the generation of the slot in the upper 32 bits. The slot holds
+	// the current index of the entry. Removed ids free their slot for the next insert with the next generation,
+	// so an old id never finds a newer entry. Insert, find, erase and move are O(1).
+	// The first n inserts into an empty map get the ids 0 to n-1.
+	class SlotMap
+	{
+	public:
+		using id_t = uint64_t;
+		using index_t = uint32_t;
+		static constexpr index_t Invalid = ~index_t(0);
+
+		// id for a new entry at index
+		id_t insert(index_t index);
+		// index of the entry, Invalid if the id is unknown or erased
+		index_t find(id_t id) const;
+		bool contains(id_t id) const { return find(id) != Invalid; }
+		// forgets the id, false if it is unknown
+		bool erase(id_t id);
+		// the entry of a known id moved to index
+		void move(id_t id, index_t index) { m_Slots[slotOf(id)].index = index; }
+
+		std::size_t size() const { return m_Size; }
+		// room for numEntries entries without allocating in insert
+		void reserve(std::size_t numEntries);
+
+	private:
+		struct Slot
+		{
+			index_t index = Invalid;	// Invalid while free
+			uint32_t generation = 0;
+		};
+
+		std::vector<Slot> m_Slots;
+		std::vector<index_t> m_FreeSlots;	// reused last in, first out
+		std::size_t m_Size = 0;
+
+		static index_t slotOf(id_t id) { return static_cast<index_t>(id); }
+		static uint32_t generationOf(id_t id) { return static_cast<uint32_t>(id >> 32); }
+	};
+}
@@ -0,0 +1,203 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Position.h"
+
+namespace PositionGenerator
+{
+	// uniform grid over a bounding cuboid, every cell holds a linked list of the positions inside it
+	// Entries are the indices of the positions in the columns passed to build(). After the positions moved,
+	// only the entries that changed their cell are relinked, which is O(1) each.
+	// Range queries and the search for close pairs only look at the cells around a position,
+	// so their cost grows with the number of positions and their density, not with its square.
+	class SpatialGrid
+	{
+	public:
+		using index_t = uint32_t;
+		static constexpr index_t Invalid = ~index_t(0);
+
+		// positions outside of the cuboid are put into the closest border cell
+		SpatialGrid(const Vector3& minValues, const Vector3& maxValues, float cellSize);
+
+		// links all positions into the grid
+		// the columns are not copied, they have to stay valid (and keep their size) for updates and queries
+		void build(std::size_t count, const float* x, const float* y, const float* z);
+
+		// recomputes the cells of the positions [first, last) after they moved
+		// may run in parallel for ranges that do not overlap
+		void computeCells(std::size_t first, std::size_t last);
+		// moves the entries whose cell changed in computeCells into their new list, returns their number
+		std::size_t relink();
+		// both steps for all positions
+		std::size_t update() { computeCells(0, size()); return relink(); }
+
+		std::size_t size() const { return m_Cell.size(); }
+		float cellSize() const { return m_CellSize; }
+		const std::array<uint32_t, 3>& dims() const { return m_Dims; }
+		std::size_t numCells() const { return m_Head.size(); }
+		index_t cellOf(index_t index) const { return m_Cell[index]; }
+
+		// calls Visit(index, squaredDistance) for every position within radius of Center
+		template <typename Visitor>
+		void forEachInRange(const Vector3& Center, float radius, Visitor&& Visit) const;
+
+		// calls Visit(first, second, squaredDistance) once for every pair of positions within radius of each other
+		// radius may be larger than the cell size, the search then covers more neighbouring cells
+		// works in scratch columns of the grid, so calls must not overlap (unlike forEachInRange)
+		template <typename Visitor>
+		void forEachPair(float radius, Visitor&& Visit) const;
+
+	private:
+		Vector3 m_Min;
+		float m_CellSize;
+		float m_InvCellSize;
+		std::array<uint32_t, 3> m_Dims{};
+
+		const float* m_pX = nullptr;
+		const float* m_pY = nullptr;
+		const float* m_pZ = nullptr;
+
+		std::vector<index_t> m_Head;	// first entry per cell
+		std::vector<index_t> m_Next;	// doubly linked, so an entry can leave its cell in O(1)
+		std::vector<index_t> m_Prev;
+		std::vector<index_t> m_Cell;	// cell the entry is linked into
+		std::vector<index_t> m_NewCell;	// cell after the last computeCells
+
+		// scratch of forEachPair, sized by build() so the search per tick does not allocate
+		mutable int m_PairReach = 0;	// reach the offsets were made for
+		mutable std::vector<std::array<int, 3>> m_PairOffsets;
+		mutable std::vector<index_t> m_PackedStart;	// first packed entry per cell
+		mutable std::vector<index_t> m_PackedIndex;
+		mutable std::vector<float> m_PackedX;
+		mutable std::vector<float> m_PackedY;
+		mutable std::vector<float> m_PackedZ;
+
+		uint32_t coordinate(float value, float min, int axis) const
+		{
+			const float cell = (value - min) * m_InvCellSize;
+			if (!(cell > 0.f))
+				return 0;
+			return std::min(static_cast<uint32_t>(cell), m_Dims[axis] - 1);
+		}
+		index_t cellIndex(uint32_t cx, uint32_t cy, uint32_t cz) const { return (cz * m_Dims[1] + cy) * m_Dims[0] + cx; }
+		index_t cellAt(float x, float y, float z) const
+		{
+			return cellIndex(coordinate(x, m_Min.x(), 0), coordinate(y, m_Min.y(), 1), coordinate(z, m_Min.z(), 2));
+		}
+		float squaredDistance(index_t first, index_t second) const
+		{
+			const float dx = m_pX[first] - m_pX[second];
+			const float dy = m_pY[first] - m_pY[second];
+			const float dz = m_pZ[first] - m_pZ[second];
+			return dx * dx + dy * dy + dz * dz;
+		}
+		void link(index_t index, index_t cell);
+		void unlink(index_t index);
+	};
+
+	template <typename Visitor>
+	void SpatialGrid::forEachInRange(const Vector3& Center, float radius, Visitor&& Visit) const
+	{
+		const float radiusSq = radius * radius;
+		const uint32_t x0 = coordinate(Center.x() - radius, m_Min.x(), 0), x1 = coordinate(Center.x() + radius, m_Min.x(), 0);
+		const uint32_t y0 = coordinate(Center.y() - radius, m_Min.y(), 1), y1 = coordinate(Center.y() + radius, m_Min.y(), 1);
+		const uint32_t z0 = coordinate(Center.z() - radius, m_Min.z(), 2), z1 = coordinate(Center.z() + radius, m_Min.z(), 2);
+		for (uint32_t cz = z0; cz <= z1; ++cz)
+			for (uint32_t cy = y0; cy <= y1; ++cy)
+				for (uint32_t cx = x0; cx <= x1; ++cx)
+					for (index_t i = m_Head[cellIndex(cx, cy, cz)]; i != Invalid; i = m_Next[i])
+					{
+						const float dx = m_pX[i] - Center.x();
+						const float dy = m_pY[i] - Center.y();
+						const float dz = m_pZ[i] - Center.z();
+						const float distSq = dx * dx + dy * dy + dz * dz;
+						if (distSq <= radiusSq)
+							Visit(i, distSq);
+					}
+	}
+
+	template <typename Visitor>
+	void SpatialGrid::forEachPair(float radius, Visitor&& Visit) const
+	{
+		const float radiusSq = radius * radius;
+		const int reach = std::max(1, static_cast<int>(std::ceil(radius * m_InvCellSize)));
+
+		// only the neighbours "after" a cell, so every pair of cells is visited once
+		if (reach != m_PairReach)
+		{
+			m_PairOffsets.clear();
+			for (int dz = -reach; dz <= reach; ++dz)
+				for (int dy = -reach; dy <= reach; ++dy)
+					for (int dx = -reach; dx <= reach; ++dx)
+						if (dz > 0 || (dz == 0 && (dy > 0 || (dy == 0 && dx > 0))))
+							m_PairOffsets.push_back({ dx, dy, dz });
+			m_PairReach = reach;
+		}
+		const auto& Offsets = m_PairOffsets;
+
+		// the lists are copied cell by cell into contiguous columns first, the pair search then streams
+		// through memory instead of chasing the links for every neighbour cell again
+		auto& CellStart = m_PackedStart;
+		index_t* const Index = m_PackedIndex.data();
+		float* const X = m_PackedX.data();
+		float* const Y = m_PackedY.data();
+		float* const Z = m_PackedZ.data();
+		index_t packed = 0;
+		for (std::size_t cell = 0; cell < m_Head.size(); ++cell)
+		{
+			CellStart[cell] = packed;
+			for (index_t i = m_Head[cell]; i != Invalid; i = m_Next[i], ++packed)
+			{
+				Index[packed] = i;
+				X[packed] = m_pX[i];
+				Y[packed] = m_pY[i];
+				Z[packed] = m_pZ[i];
+			}
+		}
+		CellStart[m_Head.size()] = packed;
+
+		auto visitPairs = [&](index_t first, index_t last, index_t otherFirst, index_t otherLast)
+			{
+				for (index_t a = first; a < last; ++a)
+				{
+					const float ax = X[a], ay = Y[a], az = Z[a];
+					for (index_t b = otherFirst < first + 1 ? a + 1 : otherFirst; b < otherLast; ++b)
+					{
+						const float dx = ax - X[b], dy = ay - Y[b], dz = az - Z[b];
+						const float distSq = dx * dx + dy * dy + dz * dz;
+						if (distSq <= radiusSq)
+							Visit(Index[a], Index[b], distSq);
+					}
+				}
+			};
+
+		const int dimX = static_cast<int>(m_Dims[0]), dimY = static_cast<int>(m_Dims[1]), dimZ = static_cast<int>(m_Dims[2]);
+		for (int cz = 0; cz < dimZ; ++cz)
+			for (int cy = 0; cy < dimY; ++cy)
+				for (int cx = 0; cx < dimX; ++cx)
+				{
+					const index_t cell = cellIndex(cx, cy, cz);
+					const index_t first = CellStart[cell], last = CellStart[cell + 1];
+					if (first == last)
+						continue;
+
+					// pairs within the cell
+					visitPairs(first, last, first, last);
+
+					// pairs with the neighbouring cells
+					for (const auto& Offset : Offsets)
+					{
+						const int nx = cx + Offset[0], ny = cy + Offset[1], nz = cz + Offset[2];
+						if (nx < 0 || ny < 0 || nz < 0 || nx >= dimX || ny >= dimY || nz >= dimZ)
+							continue;
+						const index_t neighbour = cellIndex(nx, ny, nz);
+						visitPairs(first, last, CellStart[neighbour], CellStart[neighbour + 1]);
+					}
+				}
+	}
+}
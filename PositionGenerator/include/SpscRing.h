@@ -0,0 +1,73 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include "AlignedAllocator.h"
+
+namespace PositionGenerator
+{
+	// lock-free ring buffer for exactly one producer and one consumer thread
+	// capacity is rounded up to a power of two, head and tail live on separate cache lines
+	template <typename T>
+	class SpscRing
+	{
+	public:
+		explicit SpscRing(std::size_t capacity)
+		{
+			std::size_t size = 1;
+			while (size < capacity)
+				size <<= 1;
+			m_Mask = size - 1;
+			m_Slots = std::make_unique<T[]>(size);
+		}
+		SpscRing(const SpscRing&) = delete;
+		SpscRing& operator=(const SpscRing&) = delete;
+
+		std::size_t capacity() const { return m_Mask + 1; }
+
+		// producer side, fails if the ring is full
+		bool tryPush(const T& Value)
+		{
+			const std::size_t tail = m_Tail.load(std::memory_order_relaxed);
+			if (tail - m_CachedHead > m_Mask)
+			{
+				m_CachedHead = m_Head.load(std::memory_order_acquire);
+				if (tail - m_CachedHead > m_Mask)
+					return false;
+			}
+			m_Slots[tail & m_Mask] = Value;
+			m_Tail.store(tail + 1, std::memory_order_release);
+			return true;
+		}
+
+		// consumer side, fails if the ring is empty
+		bool tryPop(T& Value)
+		{
+			const std::size_t head = m_Head.load(std::memory_order_relaxed);
+			if (head == m_CachedTail)
+			{
+				m_CachedTail = m_Tail.load(std::memory_order_acquire);
+				if (head == m_CachedTail)
+					return false;
+			}
+			Value = m_Slots[head & m_Mask];
+			m_Head.store(head + 1, std::memory_order_release);
+			return true;
+		}
+
+		bool empty() const { return m_Head.load(std::memory_order_acquire) == m_Tail.load(std::memory_order_acquire); }
+
+	private:
+		std::unique_ptr<T[]> m_Slots;
+		std::size_t m_Mask = 0;
+
+		// consumer owned
+		alignas(CacheLineSize) std::atomic<std::size_t> m_Head = 0;
+		std::size_t m_CachedTail = 0;
+
+		// producer owned
+		alignas(CacheLineSize) std::atomic<std::size_t> m_Tail = 0;
+		std::size_t m_CachedHead = 0;
+	};
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Position.h"
+
+namespace PositionGenerator
+{
+	// the parts of the GenerationParameter that decide the generated data, besides seed and time base
+	struct RunParameter
+	{
+		uint64_t numOfSensors = 0;
+		uint64_t randomPolicy = 0;
+		std::array<float, 3> minValues{};
+		std::array<float, 3> maxValues{};
+		float maxVelocity = 0.f;
+		float noiseDimension = 0.f;
+		std::vector<double> updateRates;
+
+		bool operator==(const RunParameter& Other) const = default;
+	};
+
+	// timestamps of all ticks of a run together with the seed, time base and parameters of its generator
+	// replaying the log reproduces the run bit identically
+	// (on the same platform - the standard library distributions are implementation defined)
+	class TickLog
+	{
+	public:
+		TickLog() = default;
+		TickLog(uint64_t seed, timestamp_t initialTimestamp, uint64_t timestampUnitsPerSecond, RunParameter Run)
+			: m_Seed(seed), m_InitialTimestamp(initialTimestamp), m_TimestampUnitsPerSecond(timestampUnitsPerSecond)
+			, m_Run(std::move(Run)) {}
+
+		uint64_t seed() const { return m_Seed; }
+		timestamp_t initialTimestamp() const { return m_InitialTimestamp; }
+		uint64_t timestampUnitsPerSecond() const { return m_TimestampUnitsPerSecond; }
+		const RunParameter& runParameter() const { return m_Run; }
+
+		void append(timestamp_t timestamp) { m_Timestamps.push_back(timestamp); }
+		void reserve(std::size_t numTicks) { m_Timestamps.reserve(numTicks); }
+		const std::vector<timestamp_t>& timestamps() const { return m_Timestamps; }
+		std::size_t size() const { return m_Timestamps.size(); }
+
+		// little endian binary file, throw std::runtime_error on failure
+		void save(const std::string& fileName) const;
+		static TickLog load(const std::string& fileName);
+
+	private:
+		uint64_t m_Seed = 0;
+		timestamp_t m_InitialTimestamp = 0;
+		uint64_t m_TimestampUnitsPerSecond = 1000 * 1000;
+		RunParameter m_Run;
+		std::vector<timestamp_t> m_Timestamps;
+	};
+}
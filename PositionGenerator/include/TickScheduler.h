@@ -0,0 +1,44 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+
+namespace PositionGenerator
+{
+	// fixed rate tick clock based on absolute deadlines
+	// deadline n is start + n * period, so the time spent per tick does not add up to a drift.
+	// Sleeping ends spinWindow before the deadline, the rest is busy waited for sub-millisecond accuracy.
+	class TickScheduler
+	{
+	public:
+		using Clock_t = std::chrono::steady_clock;
+
+		struct TickInfo
+		{
+			uint64_t tick = 0;					// index of the tick that is due now
+			uint64_t missedTicks = 0;		// deadlines skipped because the previous tick overran
+			Clock_t::duration slack{};	// time waited for the deadline, zero on overrun
+		};
+
+		// throws std::invalid_argument unless frequencyInHz is positive and finite
+		explicit TickScheduler(double frequencyInHz, std::chrono::nanoseconds spinWindow = std::chrono::nanoseconds(0));
+
+		// blocks until the deadline of the next tick
+		// if that deadline already passed, returns immediately and skips all but the latest missed deadline
+		TickInfo waitForNextTick();
+
+		// restarts the schedule with tick 0 due now
+		void restart();
+
+		Clock_t::duration period() const { return std::chrono::duration_cast<Clock_t::duration>(std::chrono::duration<double, std::nano>(m_PeriodNs)); }
+		uint64_t totalMissedTicks() const { return m_TotalMissed; }
+
+	private:
+		double m_PeriodNs;
+		std::chrono::nanoseconds m_SpinWindow;
+		Clock_t::time_point m_Start;
+		uint64_t m_NextTick = 0;
+		uint64_t m_TotalMissed = 0;
+
+		Clock_t::time_point deadline(uint64_t tick) const;
+	};
+}
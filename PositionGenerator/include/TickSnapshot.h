@@ -0,0 +1,55 @@
+#pragma once
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "Position.h"
+#include "SensorStore.h"
+
+namespace PositionGenerator
+{
+	// destination of a snapshot in memory not owned by a TickSnapshot, e.g. a mapped file
+	// every column needs room for all sensors of the generator
+	struct SnapshotColumns
+	{
+		sensorId_t* sensorIds = nullptr;
+		timestamp_t* timestamps = nullptr;
+		float* x = nullptr;
+		float* y = nullptr;
+		float* z = nullptr;
+	};
+
+	// published state of all sensors at one tick (positions already including noise)
+	// decouples the publish stages from the generator, which can move on to the next tick meanwhile
+	struct TickSnapshot
+	{
+		timestamp_t tickTimestamp = 0;
+		SensorStore::Column_t<sensorId_t> sensorIds;
+		SensorStore::Column_t<timestamp_t> timestamps;
+		SensorStore::Column_t<float> x;
+		SensorStore::Column_t<float> y;
+		SensorStore::Column_t<float> z;
+
+		std::size_t size() const { return sensorIds.size(); }
+
+		// keeps the capacity, so a reused snapshot does not allocate once it reached its size
+		void resize(std::size_t numSensors)
+		{
+			sensorIds.resize(numSensors);
+			timestamps.resize(numSensors);
+			x.resize(numSensors);
+			y.resize(numSensors);
+			z.resize(numSensors);
+		}
+
+		SnapshotColumns columns() { return SnapshotColumns{ sensorIds.data(), timestamps.data(), x.data(), y.data(), z.data() }; }
+	};
+
+	// shard a sensor is published in when the sensors are split over numShards publishers
+	inline std::size_t shardOf(sensorId_t sensorId, std::size_t numShards) { return static_cast<std::size_t>(sensorId % numShards); }
+
+	// distributes the sensors of Snapshot over Shards by shardOf, in their order within Snapshot
+	// the shards keep their capacity, so reused shards do not allocate once they reached their size
+	// Counts is scratch for the sensors per shard, reusing it across ticks keeps the split free of allocations
+	void splitSnapshot(const TickSnapshot& Snapshot, std::span<TickSnapshot* const> Shards, std::vector<std::size_t>& Counts);
+}
@@ -0,0 +1,109 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace PositionGenerator
+{
+	// counts of a LatencyHistogram, taken out of it for evaluation
+	struct LatencyDistribution
+	{
+		std::vector<uint64_t> counts;	// per bucket of LatencyHistogram
+
+		uint64_t count() const;
+		// smallest value (bucket upper bound) that at least the fraction q of the recorded values do not exceed, 0 if empty
+		uint64_t percentile(double q) const;
+		uint64_t max() const { return percentile(1.); }
+	};
+
+	// HDR style histogram of durations in nanoseconds
+	// 32 linear sub buckets per power of two keep every value within 1/32 (3%), values up to 2^40ns (18 minutes)
+	// recording is one relaxed atomic increment, any number of threads can record while another one collects
+	class LatencyHistogram
+	{
+	public:
+		static constexpr unsigned SubBucketBits = 5;
+		static constexpr unsigned SubBuckets = 1u << SubBucketBits;
+		static constexpr unsigned MaxExponent = 40;	// larger values end up in the last bucket
+		static constexpr std::size_t NumBuckets = (MaxExponent - SubBucketBits + 1) * SubBuckets;
+
+		void record(uint64_t valueNs) { m_Counts[bucketOf(valueNs)].fetch_add(1, std::memory_order_relaxed); }
+		void record(std::chrono::nanoseconds duration) { record(static_cast<uint64_t>(duration.count() > 0 ? duration.count() : 0)); }
+
+		// moves the counts recorded since the last collect into Out, the histogram starts from zero again
+		void collect(LatencyDistribution& Out);
+
+		static std::size_t bucketOf(uint64_t valueNs);
+		// largest value that falls into bucket
+		static uint64_t bucketUpperBound(std::size_t bucket);
+
+	private:
+		std::array<std::atomic<uint64_t>, NumBuckets> m_Counts{};
+	};
+
+	// stages of a published tick
+	enum class TickStage
+	{
+		Generate,		// Generator::generateData
+		Noise,			// snapshot with noise
+		Serialize,	// MessageBuilder::buildTick
+		Send,				// handing the frames to zeromq
+		Slack,			// time left until the next deadline
+		Count
+	};
+
+	const char* tickStageName(TickStage stage);
+
+	// latencies of the tick stages and the message throughput, shared by all threads of the publish path
+	class TickStats
+	{
+	public:
+		using Clock_t = std::chrono::steady_clock;
+
+		TickStats() : m_LastReport(Clock_t::now()) {}
+
+		void record(TickStage stage, Clock_t::duration duration) { m_Stages[static_cast<std::size_t>(stage)].record(duration); }
+		void countTick() { m_Ticks.fetch_add(1, std::memory_order_relaxed); }
+		void countMessages(std::size_t messages, std::size_t bytes)
+		{
+			m_Messages.fetch_add(messages, std::memory_order_relaxed);
+			m_Bytes.fetch_add(bytes, std::memory_order_relaxed);
+		}
+
+		// one line with p50/p99/p999 of every stage and the rates since the previous report
+		// only one thread may report
+		void report(std::ostream& Out);
+
+	private:
+		std::array<LatencyHistogram, static_cast<std::size_t>(TickStage::Count)> m_Stages;
+		std::atomic<uint64_t> m_Ticks = 0;
+		std::atomic<uint64_t> m_Messages = 0;
+		std::atomic<uint64_t> m_Bytes = 0;
+		Clock_t::time_point m_LastReport;
+		LatencyDistribution m_Distribution;	// reused by report
+	};
+
+	// records the time from construction to destruction as one stage, does nothing without stats
+	class StageTimer
+	{
+	public:
+		StageTimer(TickStats* pStats, TickStage stage)
+			: m_pStats(pStats), m_Stage(stage), m_Start(pStats ? TickStats::Clock_t::now() : TickStats::Clock_t::time_point()) {}
+		~StageTimer()
+		{
+			if (m_pStats)
+				m_pStats->record(m_Stage, TickStats::Clock_t::now() - m_Start);
+		}
+		StageTimer(const StageTimer&) = delete;
+		StageTimer& operator=(const StageTimer&) = delete;
+
+	private:
+		TickStats* m_pStats;
+		TickStage m_Stage;
+		TickStats::Clock_t::time_point m_Start;
+	};
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Position.h"
+
+namespace PositionGenerator
+{
+	// hashed timing wheel that tells which entries (sensor indices) are due at a point in time
+	// Every slot covers slotWidth timestamp units and holds the entries due in it in a plain array,
+	// so walking a slot streams through memory instead of chasing links.
+	// popDue only walks the slots between the previous and the current call, so its cost grows with
+	// the number of entries due and the elapsed time, not with the number of entries.
+	// Due times more than one turn of the wheel ahead are allowed, they are skipped until their turn comes.
+	class UpdateWheel
+	{
+	public:
+		using index_t = uint32_t;
+		static constexpr index_t Invalid = ~index_t(0);
+
+		// slotWidth is rounded down and numSlots up to a power of two, a turn of the wheel should cover the longest period
+		// entries due before start are due on the first popDue
+		UpdateWheel(timestamp_t start, timestamp_t slotWidth, std::size_t numSlots);
+
+		// entries [0, count), new entries are not scheduled
+		void resize(std::size_t count);
+		std::size_t size() const { return m_Due.size(); }
+
+		// (re)schedules index to be due at the given time
+		// schedule and cancel are O(1), an entry left behind in its old slot is dropped when that slot is walked
+		void schedule(index_t index, timestamp_t due);
+		void cancel(index_t index) { m_Slot[index] = Invalid; }
+		bool scheduled(index_t index) const { return m_Slot[index] != Invalid; }
+		timestamp_t due(index_t index) const { return m_Due[index]; }
+
+		// unschedules all entries due at or before now and appends them to Due, returns their number
+		// entries of a slot come in the order they were scheduled, independent of memory addresses
+		std::size_t popDue(timestamp_t now, std::vector<index_t>& Due);
+
+		timestamp_t slotWidth() const { return timestamp_t(1) << m_SlotShift; }
+		std::size_t numSlots() const { return m_Slots.size(); }
+
+	private:
+		unsigned m_SlotShift;	// log2 of the slot width, no division per entry
+		uint64_t m_Cursor;	// absolute number of the first slot that may hold due entries
+
+		std::vector<std::vector<index_t>> m_Slots;	// entries per slot, keep their capacity
+		std::vector<index_t> m_Slot;	// slot the entry is scheduled in, Invalid if not scheduled
+		std::vector<timestamp_t> m_Due;
+	};
+}
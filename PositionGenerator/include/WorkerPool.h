@@ -0,0 +1,59 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace PositionGenerator
+{
+	// persistent pool of worker threads that executes shards of work
+	// every participant owns a queue of shards, idle participants steal from the back of the others,
+	// so shards of uneven cost still balance. The calling thread takes part in the work as participant 0.
+	class WorkerPool
+	{
+	public:
+		using Task_t = std::function<void(std::size_t shardIndex)>;
+
+		// numThreads includes the calling thread, 0 uses one thread per hardware thread
+		explicit WorkerPool(unsigned numThreads);
+		~WorkerPool();
+		WorkerPool(const WorkerPool&) = delete;
+		WorkerPool& operator=(const WorkerPool&) = delete;
+
+		unsigned numThreads() const { return static_cast<unsigned>(m_Queues.size()); }
+
+		// executes Task for every shard in [0, numShards) and returns after all of them finished
+		// the first exception thrown by a task is rethrown here
+		void run(std::size_t numShards, const Task_t& Task);
+
+	private:
+		struct WorkQueue
+		{
+			std::mutex Mutex;
+			std::deque<std::size_t> Shards;
+		};
+
+		std::vector<std::unique_ptr<WorkQueue>> m_Queues;
+		std::vector<std::thread> m_Threads;
+
+		std::mutex m_Mutex;
+		std::condition_variable m_WakeUp;
+		std::condition_variable m_Done;
+		uint64_t m_Generation = 0;
+		bool m_Stop = false;
+
+		const Task_t* m_pTask = nullptr;
+		std::atomic<std::size_t> m_Remaining = 0;
+		std::exception_ptr m_Error;
+
+		void workerLoop(std::size_t participant);
+		void processShards(std::size_t participant);
+		bool popShard(std::size_t participant, std::size_t& shard);
+	};
+}
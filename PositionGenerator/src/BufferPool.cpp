@@ -0,0 +1,85 @@
+#include "BufferPool.h"
+
+namespace PositionGenerator
+{
+	void BufferPool::Buffer::release()
+	{
+		if (m_RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			m_pPool->giveBack(this);
+	}
+
+	void BufferPool::Buffer::StorageDeleter::operator()(uint8_t* p) const
+	{
+		if (hugePages)
+			freeHugePages(p, capacity);
+		else
+			delete[] p;
+	}
+
+	BufferPool::BufferPool(std::size_t numBuffers, std::size_t bufferCapacity, MemoryPolicy policy)
+		: m_Policy(policy)
+	{
+		m_Buffers.reserve(numBuffers);
+		m_Free.reserve(numBuffers);
+		for (std::size_t i = 0; i < numBuffers; ++i)
+		{
+			m_Buffers.emplace_back(new Buffer(this));
+			reserveStorage(*m_Buffers.back(), bufferCapacity);
+			m_Free.push_back(m_Buffers.back().get());
+		}
+	}
+
+	// buffers still referenced by someone else (e.g. queued in zeromq) must not outlive the pool
+	BufferPool::~BufferPool() = default;
+
+	BufferPool::Buffer* BufferPool::acquire(std::size_t minCapacity)
+	{
+		Buffer* pBuffer = nullptr;
+		{
+			std::lock_guard<std::mutex> Lock(m_Mutex);
+			if (!m_Free.empty())
+			{
+				pBuffer = m_Free.back();
+				m_Free.pop_back();
+			}
+			else
+			{
+				// pool exhausted - grow, the free list has to be able to take the new buffer later on
+				m_Buffers.emplace_back(new Buffer(this));
+				m_Free.reserve(m_Buffers.size());
+				pBuffer = m_Buffers.back().get();
+				++m_NumAllocations;
+			}
+		}
+
+		if (pBuffer->capacity() < minCapacity)
+		{
+			reserveStorage(*pBuffer, minCapacity);
+			++m_NumAllocations;
+		}
+		pBuffer->setSize(0);
+		pBuffer->m_RefCount.store(1, std::memory_order_relaxed);
+		return pBuffer;
+	}
+
+	std::size_t BufferPool::numFree() const
+	{
+		std::lock_guard<std::mutex> Lock(m_Mutex);
+		return m_Free.size();
+	}
+
+	void BufferPool::giveBack(Buffer* pBuffer)
+	{
+		std::lock_guard<std::mutex> Lock(m_Mutex);
+		m_Free.push_back(pBuffer);
+	}
+
+	void BufferPool::reserveStorage(Buffer& Buf, std::size_t capacity)
+	{
+		if (m_Policy == MemoryPolicy::HugePages && capacity >= MinHugePageAllocation)
+			Buf.m_Storage = std::unique_ptr<uint8_t[], Buffer::StorageDeleter>(static_cast<uint8_t*>(allocateHugePages(capacity)), { capacity, true });
+		else
+			Buf.m_Storage = std::unique_ptr<uint8_t[], Buffer::StorageDeleter>(new uint8_t[capacity], { capacity, false });
+		Buf.m_Capacity = capacity;
+	}
+}
@@ -1,94 +1,729 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
 #include "Generator.h"
 
 namespace PositionGenerator
 {
+	namespace
+	{
+		// positions per step of the batched noise, the scratch arrays stay on the stack and in L1
+		constexpr std::size_t NoiseChunkSize = 256;
+		// sensors per step of the update of due sensors, they are gathered into arrays on the stack
+		constexpr std::size_t GatherChunkSize = 256;
+
+		std::mt19937 seededEngine(uint64_t seed)
+		{
+			std::seed_seq Seq{ static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32) };
+			return std::mt19937(Seq);
+		}
+
+		RunParameter runParameterOf(const GenerationParameter& Param)
+		{
+			RunParameter Run;
+			Run.numOfSensors = static_cast<uint64_t>(Param.numOfSensors());
+			Run.randomPolicy = static_cast<uint64_t>(Param.randomPolicy());
+			Run.minValues = { Param.minValues().x(), Param.minValues().y(), Param.minValues().z() };
+			Run.maxValues = { Param.maxValues().x(), Param.maxValues().y(), Param.maxValues().z() };
+			Run.maxVelocity = Param.maxVelocity();
+			Run.noiseDimension = Param.noiseDimension();
+			Run.updateRates = Param.updateRates();
+			return Run;
+		}
+
+		GenerationParameter replayParameter(const GenerationParameter& Param, const TickLog& Log)
+		{
+			if (runParameterOf(Param) != Log.runParameter())
+				throw std::invalid_argument("ReplayGenerator: the parameters differ from the ones of the recorded run");
+			return GenerationParameter(Param)
+				.setSeed(Log.seed())
+				.setInitialTimestamp(Log.initialTimestamp())
+				.setTimestampUnitPerSecond(Log.timestampUnitsPerSecond());
+		}
+	}
+
 	Generator::Generator(const GenerationParameter& Param)
-		: m_Param(Param), m_Gen(m_Rnd())
+		: m_Seed(Param.seed() ? *Param.seed() : (static_cast<uint64_t>(m_Rnd()) << 32) | m_Rnd())
+		, m_Gen(seededEngine(m_Seed)), m_CounterRandom(m_Seed)
+		, m_Param(Param), m_Sensors(Param.memoryPolicy()), m_CurrentTimestamp(Param.initialTimestamp())
+		, m_SimdLevel(detectSimdLevel())
+		, m_TimeInSec(AlignedAllocator<float>(Param.memoryPolicy())), m_RandAcc(AlignedAllocator<float>(Param.memoryPolicy()))
+		, m_RandDirX(AlignedAllocator<float>(Param.memoryPolicy())), m_RandDirY(AlignedAllocator<float>(Param.memoryPolicy()))
 	{
+		m_Limits.maxVelocity = m_Param.maxVelocity();
+		m_Limits.minValues = m_Param.minValues();
+		m_Limits.maxValues = m_Param.maxValues();
+		// before seeding, the workers place the sensor memory
+		if (m_Param.numOfThreads() != 1)
+			m_pWorkers = std::make_unique<WorkerPool>(static_cast<unsigned>(m_Param.numOfThreads()));
 		seedSensors();
+		if (!m_Param.updateRates().empty())
+			scheduleUpdates();
+
+		const float cellSize = m_Param.gridCellSize() > 0.f ? m_Param.gridCellSize() : m_Param.proximityRadius();
+		if (cellSize > 0.f)
+		{
+			m_pGrid = std::make_unique<SpatialGrid>(m_Param.minValues(), m_Param.maxValues(), cellSize);
+			m_pGrid->build(m_Sensors.size(), m_Sensors.posX(), m_Sensors.posY(), m_Sensors.posZ());
+			updateProximity();
+		}
 	}
 
 	void Generator::generateData(timestamp_t newTimestamp)
 	{
-		for (auto& Sensor : m_Sensors)
+		m_CurrentTimestamp = newTimestamp;
+		if (m_pWheel)
+		{
+			generateDue(newTimestamp);
+			// the spatial index still looks at all sensors
+			if (m_pGrid)
+				updateGrid(false);
+			return;
+		}
+
+		const std::size_t numSensors = m_Sensors.size();
+		if (!m_pWorkers)
+		{
+			generateWithImpulse(0, numSensors, newTimestamp);
+			if (m_pGrid)
+				updateGrid(false);
+			return;
+		}
+
+		// the shared mersenne twister has to be drawn in order, only the movement runs in parallel
+		const bool counterBased = m_Param.randomPolicy() == RandomPolicy::CounterBased;
+		if (!counterBased)
+			drawImpulses(0, numSensors, newTimestamp);
+
+		// shards do not overlap and every sensor only depends on its own data and random numbers,
+		// so the result does not depend on which thread handles which shard
+		const std::size_t shardSize = static_cast<std::size_t>(m_Param.shardSize());
+		const std::size_t numShards = (numSensors + shardSize - 1) / shardSize;
+		const bool computeCells = m_pGrid && !m_GridStale;
+		m_pWorkers->run(numShards, [&](std::size_t shard)
+			{
+				const std::size_t first = shard * shardSize;
+				const std::size_t last = std::min(first + shardSize, numSensors);
+				if (counterBased)
+					drawImpulses(first, last, newTimestamp);
+				moveSensors(first, last);
+				if (computeCells)
+					m_pGrid->computeCells(first, last);
+			});
+		if (m_pGrid)
+			updateGrid(computeCells);
+	}
+
+	void Generator::updateGrid(bool cellsComputed)
+	{
+		// after sensors were added or removed the entries no longer match, a rebuild is O(n) like an update
+		if (m_GridStale)
+			m_pGrid->build(m_Sensors.size(), m_Sensors.posX(), m_Sensors.posY(), m_Sensors.posZ());
+		else if (cellsComputed)
+			m_pGrid->relink();
+		else
+			m_pGrid->update();
+		m_GridStale = false;
+		updateProximity();
+	}
+
+	sensorId_t Generator::addSensor(double updateRateHz)
+	{
+		if (m_Recording)
+			throw std::logic_error("Generator: sensors can not be added while recording");
+		if (!(updateRateHz >= 0.) || !std::isfinite(updateRateHz))
+			throw std::invalid_argument("Generator: the update rate has to be finite and not negative");
+		if (updateRateHz != 0. && !m_pWheel)
+			throw std::invalid_argument("Generator: a sensor update rate needs update rates in the parameter");
+		// validated before the sensor is inserted, a failing call leaves the generator unchanged
+		const timestamp_t period = m_pWheel ? updatePeriodOf(updateRateHz > 0. ? updateRateHz : m_Param.updateRates().front()) : 0;
+		const std::size_t index = m_Sensors.size();
+		const sensorId_t sensorId = m_Ids.insert(static_cast<SlotMap::index_t>(index));
+		m_Sensors.push_back(SensorPosition(sensorId, m_CurrentTimestamp, randomPosition(sensorId, m_CurrentTimestamp)));
+		m_TimeInSec.resize(m_Sensors.size());
+		m_RandAcc.resize(m_Sensors.size());
+		m_RandDirX.resize(m_Sensors.size());
+		m_RandDirY.resize(m_Sensors.size());
+		if (m_pWheel)
+		{
+			m_UpdatePeriods.push_back(period);
+			// the wheel does not shrink with the sensors, the entries of removed sensors are cancelled
+			if (m_pWheel->size() < m_Sensors.size())
+				m_pWheel->resize(m_Sensors.size());
+			m_pWheel->schedule(static_cast<UpdateWheel::index_t>(index), m_CurrentTimestamp + period);
+		}
+		sensorsChanged();
+		return sensorId;
+	}
+
+	bool Generator::removeSensor(sensorId_t sensorId)
+	{
+		if (m_Recording)
+			throw std::logic_error("Generator: sensors can not be removed while recording");
+		const SlotMap::index_t index = m_Ids.find(sensorId);
+		if (index == SlotMap::Invalid)
+			return false;
+		m_Ids.erase(sensorId);
+
+		// the last sensor takes the place of the removed one, so the columns stay dense
+		const SlotMap::index_t last = static_cast<SlotMap::index_t>(m_Sensors.size() - 1);
+		if (index != last)
+			m_Ids.move(m_Sensors.sensorIds()[last], index);
+		m_Sensors.eraseUnordered(index);
+		m_TimeInSec.pop_back();
+		m_RandAcc.pop_back();
+		m_RandDirX.pop_back();
+		m_RandDirY.pop_back();
+		if (m_pWheel)
 		{
-			generateWithImpulse(Sensor, newTimestamp);
+			m_pWheel->cancel(index);
+			if (index != last)
+			{
+				if (m_pWheel->scheduled(last))
+				{
+					const timestamp_t due = m_pWheel->due(last);
+					m_pWheel->cancel(last);
+					m_pWheel->schedule(index, due);
+				}
+				m_UpdatePeriods[index] = m_UpdatePeriods[last];
+			}
+			m_UpdatePeriods.pop_back();
 		}
+		sensorsChanged();
+		return true;
+	}
+
+	TickLog Generator::emptyTickLog() const
+	{
+		return TickLog(m_Seed, m_Param.initialTimestamp(), m_Param.timeStampPerSecond(), runParameterOf(m_Param));
+	}
+
+	std::optional<std::size_t> Generator::indexOf(sensorId_t sensorId) const
+	{
+		const SlotMap::index_t index = m_Ids.find(sensorId);
+		if (index == SlotMap::Invalid)
+			return std::nullopt;
+		return index;
+	}
+
+	void Generator::reserveSensors(std::size_t numSensors)
+	{
+		m_Sensors.reserve(numSensors);
+		m_Ids.reserve(numSensors);
+		m_TimeInSec.reserve(numSensors);
+		m_RandAcc.reserve(numSensors);
+		m_RandDirX.reserve(numSensors);
+		m_RandDirY.reserve(numSensors);
+		if (m_pWheel)
+		{
+			m_UpdatePeriods.reserve(numSensors);
+			m_Updated.reserve(numSensors);
+			if (m_pWheel->size() < numSensors)
+				m_pWheel->resize(numSensors);
+		}
+	}
+
+	void Generator::sensorsChanged()
+	{
+		// the indices of the last update are no longer valid
+		m_Updated.clear();
+		m_GridStale = m_pGrid != nullptr;
 	}
 
 	Vector3 Generator::addNoise(const Vector3& origPosition)
 	{
-		auto noiseIntensity = m_DistanceDist(m_Gen) * m_Param.noiseDimension();
-		auto Noise = Vector3(m_DistanceDist(m_Gen) - 0.5f, m_DistanceDist(m_Gen) - 0.5f, 0);
-		Noise.normalize();
-		Noise = Noise * noiseIntensity;
-		return Vector3(origPosition.x() + Noise.x(), origPosition.y() + Noise.y(), origPosition.z());
-	}
-
-	void Generator::generateWithImpulse(SensorPosition& Sensor, timestamp_t newTimestamp)
-	{
-		auto elapsed = newTimestamp - Sensor.timestamp();
-		float timeInSec = static_cast<float>(elapsed) / static_cast<float>(m_Param.timeStampPerSecond());
-		float maxDistance = m_Param.maxVelocity() * timeInSec;
-		
-		// some experimentation shows best results with 2.f
-		// too big and there seems to be now real movement
-		// too small and all sensor end up at the border
-		float maxAccelaration = maxDistance * 2.f; 
-		auto impulseVector = Sensor.velocity();
-
-		// random acceleration
-		float accFactor = m_DistanceDist(m_Gen) * maxAccelaration;
-		auto accDirection = Vector3(m_DistanceDist(m_Gen) - 0.5f, m_DistanceDist(m_Gen) - 0.5f, 0);
-		accDirection.normalize();
-		auto acceleration = accFactor * accDirection;
-		
-		auto move = Sensor.velocity() + acceleration;
-		// now make sure, that move is less or equal to maxVelocity
-		float resultingVelo = sqrtf(scalarProduct(move, move));
-		if (resultingVelo > maxDistance)
-		{ 
-			// if we just use maxDistance/resultingVelo as factor, we end up with rounding errors above maxDistance
-			// which will fail our tests, thats why we introduce a safety factor
-			constexpr float safety = 0.001f;
-			move = move * ((maxDistance-safety) / resultingVelo);
-		}
-		auto newPos = Sensor.position() + move;
-		clamp(newPos);
-
-		// update position and timestamp for sensor
-		if (timeInSec > 1.E-20f)
-			Sensor.setVelocity((newPos - Sensor.position())*(1/timeInSec));
-		Sensor.setPosition(newPos);
-		Sensor.setTimestamp(newTimestamp);
-	}
-
-	void Generator::clamp(Vector3& Pos)
-	{
-		const Vector3& minV = m_Param.minValues();
-		const Vector3& maxV = m_Param.maxValues();
-		Pos.x() = std::clamp(Pos.x(), minV.x(), maxV.x());
-		Pos.y() = std::clamp(Pos.y(), minV.y(), maxV.y());
-		Pos.z() = std::clamp(Pos.z(), minV.z(), maxV.z());
+		if (m_Param.randomPolicy() == RandomPolicy::CounterBased)
+		{
+			// no sensor known, use a running counter as tick in a sensor id range the generator never hands out
+			auto rnd = m_CounterRandom.uniform(RandomStream::Noise, ~0ull, m_NoiseCounter++);
+			return noisyPosition(origPosition, rnd[0], rnd[1], rnd[2]);
+		}
+		auto noiseIntensity = m_DistanceDist(m_Gen);
+		auto dirX = m_DistanceDist(m_Gen);
+		auto dirY = m_DistanceDist(m_Gen);
+		return noisyPosition(origPosition, noiseIntensity, dirX, dirY);
+	}
+
+	Vector3 Generator::addNoise(const SensorPosition& Sensor)
+	{
+		if (m_Param.randomPolicy() == RandomPolicy::CounterBased)
+		{
+			auto rnd = m_CounterRandom.uniform(RandomStream::Noise, Sensor.sensorId(), Sensor.timestamp());
+			return noisyPosition(Sensor.position(), rnd[0], rnd[1], rnd[2]);
+		}
+		return addNoise(Sensor.position());
+	}
+
+	void Generator::addNoise(std::span<const Vector3> In, std::span<Vector3> Out)
+	{
+		if (In.size() != Out.size())
+			throw std::invalid_argument("Generator: addNoise needs as many output as input positions");
+		const bool counterBased = m_Param.randomPolicy() == RandomPolicy::CounterBased;
+		const std::size_t count = In.size();
+		alignas(CacheLineSize) float x[NoiseChunkSize];
+		alignas(CacheLineSize) float y[NoiseChunkSize];
+		alignas(CacheLineSize) sensorId_t sensorIds[NoiseChunkSize];
+		alignas(CacheLineSize) timestamp_t ticks[NoiseChunkSize];
+		for (std::size_t first = 0; first < count; first += NoiseChunkSize)
+		{
+			const std::size_t n = std::min(NoiseChunkSize, count - first);
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				x[i] = In[first + i].x();
+				y[i] = In[first + i].y();
+				if (counterBased)
+				{
+					// same numbers as addNoise(const Vector3&)
+					sensorIds[i] = ~0ull;
+					ticks[i] = m_NoiseCounter++;
+				}
+			}
+			noiseColumns(n, sensorIds, ticks, x, y, x, y);
+			for (std::size_t i = 0; i < n; ++i)
+				Out[first + i] = Vector3(x[i], y[i], In[first + i].z());
+		}
+	}
+
+	void Generator::captureSnapshot(TickSnapshot& Snapshot)
+	{
+		Snapshot.resize(m_Sensors.size());
+		Snapshot.tickTimestamp = m_CurrentTimestamp;
+		captureSnapshot(Snapshot.columns());
+	}
+
+	bool Generator::publishSnapshot(SharedSnapshot& Shared)
+	{
+		TickSnapshot* pSnapshot = Shared.writeBuffer();
+		if (!pSnapshot)
+			return false;
+		captureSnapshot(*pSnapshot);
+		return Shared.publish();
+	}
+
+	void Generator::captureUpdates(TickSnapshot& Snapshot)
+	{
+		if (!m_pWheel)
+		{
+			captureSnapshot(Snapshot);
+			return;
+		}
+		const std::size_t numUpdated = m_Updated.size();
+		Snapshot.resize(numUpdated);
+		Snapshot.tickTimestamp = m_CurrentTimestamp;
+		for (std::size_t i = 0; i < numUpdated; ++i)
+		{
+			const std::size_t index = m_Updated[i];
+			Snapshot.sensorIds[i] = m_Sensors.sensorIds()[index];
+			Snapshot.timestamps[i] = m_Sensors.timestamps()[index];
+			Snapshot.x[i] = m_Sensors.posX()[index];
+			Snapshot.y[i] = m_Sensors.posY()[index];
+			Snapshot.z[i] = m_Sensors.posZ()[index];
+		}
+		noiseColumns(numUpdated, Snapshot.sensorIds.data(), Snapshot.timestamps.data(),
+			Snapshot.x.data(), Snapshot.y.data(), Snapshot.x.data(), Snapshot.y.data());
+	}
+
+	void Generator::captureSnapshot(const SnapshotColumns& Columns)
+	{
+		const std::size_t numSensors = m_Sensors.size();
+		std::copy_n(m_Sensors.sensorIds(), numSensors, Columns.sensorIds);
+		std::copy_n(m_Sensors.timestamps(), numSensors, Columns.timestamps);
+		std::copy_n(m_Sensors.posZ(), numSensors, Columns.z);
+		noiseColumns(numSensors, m_Sensors.sensorIds(), m_Sensors.timestamps(),
+			m_Sensors.posX(), m_Sensors.posY(), Columns.x, Columns.y);
+	}
+
+	Vector3 Generator::estimatePosition(std::size_t index, timestamp_t timestamp) const
+	{
+		sensorId_t sensorId;
+		timestamp_t sensorTimestamp;
+		float x, y, z;
+		estimatePositions(index, index + 1, timestamp, SnapshotColumns{ &sensorId, &sensorTimestamp, &x, &y, &z });
+		return Vector3(x, y, z);
+	}
+
+	void Generator::estimatePositions(std::size_t first, std::size_t last, timestamp_t timestamp, const SnapshotColumns& Out) const
+	{
+		const float invTimeStampPerSecond = 1.f / static_cast<float>(m_Param.timeStampPerSecond());
+		const sensorId_t* sensorIds = m_Sensors.sensorIds();
+		const timestamp_t* timestamps = m_Sensors.timestamps();
+		const float* posX = m_Sensors.posX();
+		const float* posY = m_Sensors.posY();
+		const float* posZ = m_Sensors.posZ();
+		const float* veloX = m_Sensors.veloX();
+		const float* veloY = m_Sensors.veloY();
+		const float* veloZ = m_Sensors.veloZ();
+		for (std::size_t i = first; i < last; ++i)
+		{
+			// negative before the last update
+			const float timeInSec = static_cast<float>(static_cast<int64_t>(timestamp - timestamps[i])) * invTimeStampPerSecond;
+			const std::size_t out = i - first;
+			Out.sensorIds[out] = sensorIds[i];
+			Out.timestamps[out] = timestamp;
+			Out.x[out] = std::clamp(posX[i] + veloX[i] * timeInSec, m_Limits.minValues.x(), m_Limits.maxValues.x());
+			Out.y[out] = std::clamp(posY[i] + veloY[i] * timeInSec, m_Limits.minValues.y(), m_Limits.maxValues.y());
+			Out.z[out] = std::clamp(posZ[i] + veloZ[i] * timeInSec, m_Limits.minValues.z(), m_Limits.maxValues.z());
+		}
+	}
+
+	void Generator::noiseColumns(std::size_t count, const sensorId_t* sensorIds, const timestamp_t* ticks,
+		const float* inX, const float* inY, float* outX, float* outY)
+	{
+		const bool counterBased = m_Param.randomPolicy() == RandomPolicy::CounterBased;
+		alignas(CacheLineSize) float randIntensity[NoiseChunkSize];
+		alignas(CacheLineSize) float randDirX[NoiseChunkSize];
+		alignas(CacheLineSize) float randDirY[NoiseChunkSize];
+		for (std::size_t first = 0; first < count; first += NoiseChunkSize)
+		{
+			const std::size_t n = std::min(NoiseChunkSize, count - first);
+			if (counterBased)
+			{
+				RandomBatch Random;
+				Random.count = n;
+				Random.key = m_CounterRandom.key(RandomStream::Noise);
+				Random.sensorIds = sensorIds + first;
+				Random.ticks = ticks + first;
+				Random.out0 = randIntensity;
+				Random.out1 = randDirX;
+				Random.out2 = randDirY;
+				uniformBatch(Random, m_SimdLevel);
+			}
+			else
+			{
+				// sequential state, same order of draws as the single position addNoise
+				for (std::size_t i = 0; i < n; ++i)
+				{
+					randIntensity[i] = m_DistanceDist(m_Gen);
+					randDirX[i] = m_DistanceDist(m_Gen);
+					randDirY[i] = m_DistanceDist(m_Gen);
+				}
+			}
+
+			NoiseBatch Batch;
+			Batch.count = n;
+			Batch.noiseDimension = m_Param.noiseDimension();
+			Batch.randIntensity = randIntensity;
+			Batch.randDirX = randDirX;
+			Batch.randDirY = randDirY;
+			Batch.posX = inX + first;
+			Batch.posY = inY + first;
+			Batch.outX = outX + first;
+			Batch.outY = outY + first;
+			applyNoise(Batch, m_SimdLevel);
+		}
+	}
+
+	Vector3 Generator::noisyPosition(const Vector3& origPosition, float intensity, float dirX, float dirY) const
+	{
+		// the batch kernel for a single position, so single and batched noise are bit identical
+		float x = origPosition.x();
+		float y = origPosition.y();
+		NoiseBatch Batch;
+		Batch.count = 1;
+		Batch.noiseDimension = m_Param.noiseDimension();
+		Batch.randIntensity = &intensity;
+		Batch.randDirX = &dirX;
+		Batch.randDirY = &dirY;
+		Batch.posX = &x;
+		Batch.posY = &y;
+		Batch.outX = &x;
+		Batch.outY = &y;
+		applyNoise(Batch, SimdLevel::Scalar);
+		return Vector3(x, y, origPosition.z());
+	}
+
+	void Generator::generateWithImpulse(std::size_t first, std::size_t last, timestamp_t newTimestamp)
+	{
+		drawImpulses(first, last, newTimestamp);
+		moveSensors(first, last);
+	}
+
+	void Generator::drawImpulses(std::size_t first, std::size_t last, timestamp_t newTimestamp)
+	{
+		timestamp_t* timestamps = m_Sensors.timestamps();
+
+		// elapsed time first, afterwards all sensors of the range carry the timestamp of the tick
+		const float timeStampPerSecond = static_cast<float>(m_Param.timeStampPerSecond());
+		for (std::size_t i = first; i < last; ++i)
+		{
+			auto elapsed = newTimestamp - timestamps[i];
+			m_TimeInSec[i] = static_cast<float>(elapsed) / timeStampPerSecond;
+			timestamps[i] = newTimestamp;
+		}
+
+		// draw all random numbers up front, the motion itself is then done by the batched (vectorized) kernel
+		if (m_Param.randomPolicy() == RandomPolicy::CounterBased)
+		{
+			// the tick is identified by its timestamp, so the numbers do not depend on the processing order
+			RandomBatch Random;
+			Random.count = last - first;
+			Random.key = m_CounterRandom.key(RandomStream::Motion);
+			Random.sensorIds = m_Sensors.sensorIds() + first;
+			Random.ticks = timestamps + first;
+			Random.out0 = m_RandAcc.data() + first;
+			Random.out1 = m_RandDirX.data() + first;
+			Random.out2 = m_RandDirY.data() + first;
+			uniformBatch(Random, m_SimdLevel);
+		}
+		else
+		{
+			// sequential state, has to be drawn in sensor order
+			for (std::size_t i = first; i < last; ++i)
+			{
+				m_RandAcc[i] = m_DistanceDist(m_Gen);
+				m_RandDirX[i] = m_DistanceDist(m_Gen);
+				m_RandDirY[i] = m_DistanceDist(m_Gen);
+			}
+		}
+	}
+
+	void Generator::moveSensors(std::size_t first, std::size_t last)
+	{
+		MotionBatch Batch;
+		Batch.count = last - first;
+		Batch.timeInSec = m_TimeInSec.data() + first;
+		Batch.randAcc = m_RandAcc.data() + first;
+		Batch.randDirX = m_RandDirX.data() + first;
+		Batch.randDirY = m_RandDirY.data() + first;
+		Batch.posX = m_Sensors.posX() + first;
+		Batch.posY = m_Sensors.posY() + first;
+		Batch.posZ = m_Sensors.posZ() + first;
+		Batch.veloX = m_Sensors.veloX() + first;
+		Batch.veloY = m_Sensors.veloY() + first;
+		Batch.veloZ = m_Sensors.veloZ() + first;
+		advanceSensors(Batch, m_Limits, m_SimdLevel);
+	}
+
+	void Generator::generateDue(timestamp_t newTimestamp)
+	{
+		m_Updated.clear();
+		m_pWheel->popDue(newTimestamp, m_Updated);
+		// next update one period after the due time, so the rate does not drift with the tick times
+		for (auto index : m_Updated)
+		{
+			timestamp_t next = m_pWheel->due(index) + m_UpdatePeriods[index];
+			if (next <= newTimestamp)
+				next = newTimestamp + m_UpdatePeriods[index];
+			m_pWheel->schedule(index, next);
+		}
+
+		const std::size_t numUpdated = m_Updated.size();
+		if (!m_pWorkers || m_Param.randomPolicy() != RandomPolicy::CounterBased)
+		{
+			moveUpdated(0, numUpdated, newTimestamp);
+			return;
+		}
+		const std::size_t shardSize = static_cast<std::size_t>(m_Param.shardSize());
+		const std::size_t numShards = (numUpdated + shardSize - 1) / shardSize;
+		m_pWorkers->run(numShards, [&](std::size_t shard)
+			{
+				const std::size_t first = shard * shardSize;
+				moveUpdated(first, std::min(first + shardSize, numUpdated), newTimestamp);
+			});
+	}
+
+	void Generator::moveUpdated(std::size_t first, std::size_t last, timestamp_t newTimestamp)
+	{
+		// the same steps as drawImpulses and moveSensors, on copies of the scattered sensors
+		const bool counterBased = m_Param.randomPolicy() == RandomPolicy::CounterBased;
+		const float timeStampPerSecond = static_cast<float>(m_Param.timeStampPerSecond());
+		timestamp_t* timestamps = m_Sensors.timestamps();
+		alignas(CacheLineSize) sensorId_t sensorIds[GatherChunkSize];
+		alignas(CacheLineSize) timestamp_t ticks[GatherChunkSize];
+		alignas(CacheLineSize) float timeInSec[GatherChunkSize];
+		alignas(CacheLineSize) float randAcc[GatherChunkSize];
+		alignas(CacheLineSize) float randDirX[GatherChunkSize];
+		alignas(CacheLineSize) float randDirY[GatherChunkSize];
+		alignas(CacheLineSize) float pos[3][GatherChunkSize];
+		alignas(CacheLineSize) float velo[3][GatherChunkSize];
+		for (std::size_t chunk = first; chunk < last; chunk += GatherChunkSize)
+		{
+			const std::size_t n = std::min(GatherChunkSize, last - chunk);
+			const UpdateWheel::index_t* indices = m_Updated.data() + chunk;
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				const std::size_t index = indices[i];
+				timeInSec[i] = static_cast<float>(newTimestamp - timestamps[index]) / timeStampPerSecond;
+				timestamps[index] = newTimestamp;
+				sensorIds[i] = m_Sensors.sensorIds()[index];
+				ticks[i] = newTimestamp;
+				pos[0][i] = m_Sensors.posX()[index];
+				pos[1][i] = m_Sensors.posY()[index];
+				pos[2][i] = m_Sensors.posZ()[index];
+				velo[0][i] = m_Sensors.veloX()[index];
+				velo[1][i] = m_Sensors.veloY()[index];
+				velo[2][i] = m_Sensors.veloZ()[index];
+			}
+
+			if (counterBased)
+			{
+				RandomBatch Random;
+				Random.count = n;
+				Random.key = m_CounterRandom.key(RandomStream::Motion);
+				Random.sensorIds = sensorIds;
+				Random.ticks = ticks;
+				Random.out0 = randAcc;
+				Random.out1 = randDirX;
+				Random.out2 = randDirY;
+				uniformBatch(Random, m_SimdLevel);
+			}
+			else
+			{
+				for (std::size_t i = 0; i < n; ++i)
+				{
+					randAcc[i] = m_DistanceDist(m_Gen);
+					randDirX[i] = m_DistanceDist(m_Gen);
+					randDirY[i] = m_DistanceDist(m_Gen);
+				}
+			}
+
+			MotionBatch Batch;
+			Batch.count = n;
+			Batch.timeInSec = timeInSec;
+			Batch.randAcc = randAcc;
+			Batch.randDirX = randDirX;
+			Batch.randDirY = randDirY;
+			Batch.posX = pos[0];
+			Batch.posY = pos[1];
+			Batch.posZ = pos[2];
+			Batch.veloX = velo[0];
+			Batch.veloY = velo[1];
+			Batch.veloZ = velo[2];
+			advanceSensors(Batch, m_Limits, m_SimdLevel);
+
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				const std::size_t index = indices[i];
+				m_Sensors.posX()[index] = pos[0][i];
+				m_Sensors.posY()[index] = pos[1][i];
+				m_Sensors.posZ()[index] = pos[2][i];
+				m_Sensors.veloX()[index] = velo[0][i];
+				m_Sensors.veloY()[index] = velo[1][i];
+				m_Sensors.veloZ()[index] = velo[2][i];
+			}
+		}
 	}
 
 	void Generator::seedSensors()
 	{
 		// for safety, if seedSensors get called outside ctor
 		m_Sensors.clear();
+		m_Ids = SlotMap();
+		const std::size_t numSensors = static_cast<std::size_t>(std::max(0, m_Param.numOfSensors()));
+		const std::size_t capacity = std::max(numSensors, m_Param.sensorCapacity());
+		reserveSensors(capacity);
+		placeSensors(capacity);
 
-		Vector3 size = m_Param.maxValues() - m_Param.minValues();
 		for (int i = 0; i < m_Param.numOfSensors(); ++i)
 		{
-			Vector3 randomPosWithinSize(
-				m_DistanceDist(m_Gen) * size.x(),
-				m_DistanceDist(m_Gen) * size.y(),
-				m_DistanceDist(m_Gen) * size.z());
-			auto randomPosWithinBounds = m_Param.minValues() + randomPosWithinSize;
-			m_Sensors.emplace_back(i, m_Param.initialTimestamp(), randomPosWithinBounds);
+			// the first ids of an empty slot map are 0 to n-1
+			const sensorId_t sensorId = m_Ids.insert(static_cast<SlotMap::index_t>(i));
+			m_Sensors.push_back(SensorPosition(sensorId, m_Param.initialTimestamp(), randomPosition(sensorId, m_Param.initialTimestamp())));
 		}
+
+		// scratch columns for the batched update
+		m_TimeInSec.resize(m_Sensors.size());
+		m_RandAcc.resize(m_Sensors.size());
+		m_RandDirX.resize(m_Sensors.size());
+		m_RandDirY.resize(m_Sensors.size());
+	}
+
+	void Generator::placeSensors(std::size_t capacity)
+	{
+		// the pages of the reserved columns are not backed yet, the first write decides their NUMA node.
+		// Writing them from the worker that gets the shard in generateData keeps the update loop on local memory,
+		// as long as the worker does not steal or migrate. Pages shared by two shards go to the first writer.
+		// The shards continue past the initial sensors, sensors added later land in the same layout
+		if (!m_pWorkers || m_Param.memoryPolicy() != MemoryPolicy::HugePages)
+			return;
+		const std::size_t shardSize = static_cast<std::size_t>(m_Param.shardSize());
+		const std::size_t numShards = (capacity + shardSize - 1) / shardSize;
+		m_pWorkers->run(numShards, [&](std::size_t shard)
+			{
+				const std::size_t first = shard * shardSize;
+				const std::size_t last = std::min(first + shardSize, capacity);
+				m_Sensors.touchCapacity(first, last);
+				SensorStore::touchCapacity(m_TimeInSec, first, last);
+				SensorStore::touchCapacity(m_RandAcc, first, last);
+				SensorStore::touchCapacity(m_RandDirX, first, last);
+				SensorStore::touchCapacity(m_RandDirY, first, last);
+			});
+	}
+
+	Vector3 Generator::randomPosition(sensorId_t sensorId, timestamp_t timestamp)
+	{
+		std::array<float, 4> rnd;
+		if (m_Param.randomPolicy() == RandomPolicy::CounterBased)
+			rnd = m_CounterRandom.uniform(RandomStream::Seed, sensorId, timestamp);
+		else
+			rnd = { m_DistanceDist(m_Gen), m_DistanceDist(m_Gen), m_DistanceDist(m_Gen), 0.f };
+		Vector3 size = m_Param.maxValues() - m_Param.minValues();
+		Vector3 randomPosWithinSize(
+			rnd[0] * size.x(),
+			rnd[1] * size.y(),
+			rnd[2] * size.z());
+		return m_Param.minValues() + randomPosWithinSize;
+	}
+
+	timestamp_t Generator::updatePeriodOf(double rateHz) const
+	{
+		if (!(rateHz > 0.) || !std::isfinite(rateHz))
+			throw std::invalid_argument("Generator: update rates have to be positive");
+		const double timeStampPerSecond = static_cast<double>(m_Param.timeStampPerSecond());
+		return std::max<timestamp_t>(1, static_cast<timestamp_t>(std::llround(timeStampPerSecond / rateHz)));
 	}
 	
+	void Generator::scheduleUpdates()
+	{
+		timestamp_t minPeriod = ~timestamp_t(0), maxPeriod = 1;
+		std::vector<timestamp_t> ClassPeriods;
+		for (double rate : m_Param.updateRates())
+		{
+			const timestamp_t period = updatePeriodOf(rate);
+			ClassPeriods.push_back(period);
+			minPeriod = std::min(minPeriod, period);
+			maxPeriod = std::max(maxPeriod, period);
+		}
+
+		// a few slots per shortest period, one turn of the wheel covers the longest one
+		const timestamp_t slotWidth = std::max<timestamp_t>(1, minPeriod / 4);
+		m_pWheel = std::make_unique<UpdateWheel>(m_Param.initialTimestamp(), slotWidth,
+			static_cast<std::size_t>(std::min<timestamp_t>(maxPeriod / slotWidth + 2, 1 << 20)));
+		m_pWheel->resize(m_Sensors.size());
+		m_UpdatePeriods.resize(m_Sensors.size());
+		reserveSensors(std::max(m_Sensors.size(), m_Param.sensorCapacity()));
+		const std::size_t numSensors = m_Sensors.size(), numGroups = ClassPeriods.size();
+		for (std::size_t group = 0; group < numGroups; ++group)
+		{
+			const std::size_t first = (group * numSensors + numGroups - 1) / numGroups;
+			const std::size_t last = ((group + 1) * numSensors + numGroups - 1) / numGroups;
+			const timestamp_t period = ClassPeriods[group];
+			for (std::size_t i = first; i < last; ++i)
+			{
+				m_UpdatePeriods[i] = period;
+				// first updates spread evenly over one period in index order, so the sensors of a group are not all
+				// due on the same tick and the ones due together are close in memory
+				const double phase = static_cast<double>(i - first) / static_cast<double>(last - first) * static_cast<double>(period);
+				m_pWheel->schedule(static_cast<UpdateWheel::index_t>(i), m_Param.initialTimestamp() + 1 + static_cast<timestamp_t>(phase));
+			}
+		}
+	}
+
+	void Generator::updateProximity()
+	{
+		m_ProximityEvents.clear();
+		const float radius = m_Param.proximityRadius();
+		if (!(radius > 0.f))
+			return;
+		const sensorId_t* sensorIds = m_Sensors.sensorIds();
+		m_pGrid->forEachPair(radius, [&](SpatialGrid::index_t first, SpatialGrid::index_t second, float distSq)
+			{
+				auto Ids = std::minmax(sensorIds[first], sensorIds[second]);
+				m_ProximityEvents.push_back(ProximityEvent{ Ids.first, Ids.second, std::sqrt(distSq) });
+			});
+	}
+
 	// ChronoBasedGenerator
 	ChronoBasedGenerator::ChronoBasedGenerator(const GenerationParameter& Param)
 		: Generator(
@@ -104,5 +739,29 @@ namespace PositionGenerator
 		auto now = std::chrono::high_resolution_clock::now();
 		timestamp_t newTime = std::chrono::duration_cast<std::chrono::microseconds>(now - m_Start).count();
 		Generator::generateData(newTime);
+		if (m_pRecord)
+			m_pRecord->append(newTime);
+	}
+
+	void ChronoBasedGenerator::recordTo(TickLog* pLog)
+	{
+		if (pLog)
+			*pLog = emptyTickLog();
+		m_pRecord = pLog;
+		m_Recording = pLog != nullptr;
+	}
+
+	// ReplayGenerator
+	ReplayGenerator::ReplayGenerator(const GenerationParameter& Param, TickLog Log)
+		: Generator(replayParameter(Param, Log))
+		, m_Log(std::move(Log))
+	{}
+
+	bool ReplayGenerator::generateData()
+	{
+		if (finished())
+			return false;
+		Generator::generateData(m_Log.timestamps()[m_NextTick++]);
+		return true;
 	}
 }
\ No newline at end of file
@@ -0,0 +1,80 @@
+#include <cstdint>
+#include <new>
+
+#include "HugePages.h"
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#elif defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace PositionGenerator
+{
+	namespace
+	{
+		std::size_t roundUp(std::size_t value, std::size_t multiple)
+		{
+			return (value + multiple - 1) / multiple * multiple;
+		}
+	}
+
+#if defined(_WIN32)
+	void* allocateHugePages(std::size_t bytes)
+	{
+		// large pages need SeLockMemoryPrivilege and are committed right away, fall back to regular pages
+		static const std::size_t largePageSize = GetLargePageMinimum();
+		if (largePageSize > 0)
+		{
+			if (void* p = VirtualAlloc(nullptr, roundUp(bytes, largePageSize), MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE))
+				return p;
+		}
+		void* p = VirtualAlloc(nullptr, roundUp(bytes, HugePageSize), MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+		if (!p)
+			throw std::bad_alloc();
+		return p;
+	}
+
+	void freeHugePages(void* p, std::size_t)
+	{
+		if (p)
+			VirtualFree(p, 0, MEM_RELEASE);
+	}
+#elif defined(__linux__)
+	void* allocateHugePages(std::size_t bytes)
+	{
+		// map one page more and cut off the ends, huge pages are only used for aligned 2MB ranges
+		const std::size_t size = roundUp(bytes, HugePageSize);
+		void* pMapped = ::mmap(nullptr, size + HugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (pMapped == MAP_FAILED)
+			throw std::bad_alloc();
+		const auto begin = reinterpret_cast<uintptr_t>(pMapped);
+		const auto aligned = roundUp(begin, HugePageSize);
+		if (aligned > begin)
+			::munmap(pMapped, aligned - begin);
+		const std::size_t tail = begin + HugePageSize - aligned;
+		if (tail > 0)
+			::munmap(reinterpret_cast<void*>(aligned + size), tail);
+		// only a hint, transparent huge pages may be switched off
+		::madvise(reinterpret_cast<void*>(aligned), size, MADV_HUGEPAGE);
+		return reinterpret_cast<void*>(aligned);
+	}
+
+	void freeHugePages(void* p, std::size_t bytes)
+	{
+		if (p)
+			::munmap(p, roundUp(bytes, HugePageSize));
+	}
+#else
+	void* allocateHugePages(std::size_t bytes)
+	{
+		return ::operator new(roundUp(bytes, HugePageSize), std::align_val_t(HugePageSize));
+	}
+
+	void freeHugePages(void* p, std::size_t)
+	{
+		::operator delete(p, std::align_val_t(HugePageSize));
+	}
+#endif
+}
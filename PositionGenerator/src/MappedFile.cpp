@@ -0,0 +1,215 @@
+#include <stdexcept>
+#include <utility>
+
+#include "MappedFile.h"
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace PositionGenerator
+{
+	namespace
+	{
+#if !defined(_WIN32)
+		// for calls returning the error code instead of setting errno
+		[[noreturn]] void fail(const std::string& what, const std::string& fileName, int errorCode)
+		{
+			throw std::runtime_error("MappedFile: " + what + " " + fileName + " (" + std::strerror(errorCode) + ")");
+		}
+#endif
+
+		[[noreturn]] void fail(const std::string& what, const std::string& fileName)
+		{
+#if defined(_WIN32)
+			throw std::runtime_error("MappedFile: " + what + " " + fileName + " (error " + std::to_string(GetLastError()) + ")");
+#else
+			fail(what, fileName, errno);
+#endif
+		}
+	}
+
+	MappedFile::~MappedFile()
+	{
+		close();
+	}
+
+	MappedFile::MappedFile(MappedFile&& Other) noexcept
+	{
+		*this = std::move(Other);
+	}
+
+	MappedFile& MappedFile::operator=(MappedFile&& Other) noexcept
+	{
+		if (this != &Other)
+		{
+			close();
+			std::swap(m_pData, Other.m_pData);
+			std::swap(m_Size, Other.m_Size);
+			std::swap(m_Writable, Other.m_Writable);
+#if defined(_WIN32)
+			std::swap(m_hFile, Other.m_hFile);
+			std::swap(m_hMapping, Other.m_hMapping);
+#else
+			std::swap(m_Fd, Other.m_Fd);
+#endif
+		}
+		return *this;
+	}
+
+#if defined(_WIN32)
+	MappedFile MappedFile::create(const std::string& fileName, std::size_t size)
+	{
+		MappedFile File;
+		File.m_hFile = CreateFileA(fileName.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (File.m_hFile == INVALID_HANDLE_VALUE)
+		{
+			File.m_hFile = nullptr;
+			fail("can not create", fileName);
+		}
+		const auto size64 = static_cast<unsigned long long>(size);
+		File.m_hMapping = CreateFileMappingA(File.m_hFile, nullptr, PAGE_READWRITE, static_cast<DWORD>(size64 >> 32), static_cast<DWORD>(size64), nullptr);
+		if (!File.m_hMapping)
+			fail("can not map", fileName);
+		File.m_pData = static_cast<uint8_t*>(MapViewOfFile(File.m_hMapping, FILE_MAP_WRITE, 0, 0, size));
+		if (!File.m_pData)
+			fail("can not map", fileName);
+		File.m_Size = size;
+		File.m_Writable = true;
+		return File;
+	}
+
+	MappedFile MappedFile::openReadOnly(const std::string& fileName)
+	{
+		MappedFile File;
+		File.m_hFile = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (File.m_hFile == INVALID_HANDLE_VALUE)
+		{
+			File.m_hFile = nullptr;
+			fail("can not open", fileName);
+		}
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(File.m_hFile, &fileSize))
+			fail("can not read size of", fileName);
+		File.m_Size = static_cast<std::size_t>(fileSize.QuadPart);
+		if (File.m_Size == 0)
+			return File;
+		File.m_hMapping = CreateFileMappingA(File.m_hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!File.m_hMapping)
+			fail("can not map", fileName);
+		File.m_pData = static_cast<uint8_t*>(MapViewOfFile(File.m_hMapping, FILE_MAP_READ, 0, 0, 0));
+		if (!File.m_pData)
+			fail("can not map", fileName);
+		return File;
+	}
+
+	void MappedFile::adviseSequential()
+	{
+		// no equivalent for mapped views, the windows cache manager detects sequential access itself
+	}
+
+	void MappedFile::flush()
+	{
+		if (m_pData && m_Writable)
+		{
+			FlushViewOfFile(m_pData, 0);
+			FlushFileBuffers(m_hFile);
+		}
+	}
+
+	void MappedFile::close()
+	{
+		if (m_pData)
+			UnmapViewOfFile(m_pData);
+		if (m_hMapping)
+			CloseHandle(m_hMapping);
+		if (m_hFile)
+			CloseHandle(m_hFile);
+		m_pData = nullptr;
+		m_hMapping = nullptr;
+		m_hFile = nullptr;
+		m_Size = 0;
+	}
+#else
+	MappedFile MappedFile::create(const std::string& fileName, std::size_t size)
+	{
+		MappedFile File;
+		File.m_Fd = ::open(fileName.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+		if (File.m_Fd < 0)
+			fail("can not create", fileName);
+		// reserve the blocks up front, a full disk fails here instead of with SIGBUS while writing
+		if (::ftruncate(File.m_Fd, static_cast<off_t>(size)) != 0)
+			fail("can not resize", fileName);
+#if defined(__linux__)
+		if (size > 0)
+		{
+			// returns the error, errno is not set
+			const int error = ::posix_fallocate(File.m_Fd, 0, static_cast<off_t>(size));
+			if (error != 0)
+				fail("can not allocate", fileName, error);
+		}
+#endif
+		if (size > 0)
+		{
+			void* p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, File.m_Fd, 0);
+			if (p == MAP_FAILED)
+				fail("can not map", fileName);
+			File.m_pData = static_cast<uint8_t*>(p);
+		}
+		File.m_Size = size;
+		File.m_Writable = true;
+		return File;
+	}
+
+	MappedFile MappedFile::openReadOnly(const std::string& fileName)
+	{
+		MappedFile File;
+		File.m_Fd = ::open(fileName.c_str(), O_RDONLY);
+		if (File.m_Fd < 0)
+			fail("can not open", fileName);
+		struct stat Info;
+		if (::fstat(File.m_Fd, &Info) != 0)
+			fail("can not read size of", fileName);
+		File.m_Size = static_cast<std::size_t>(Info.st_size);
+		if (File.m_Size > 0)
+		{
+			void* p = ::mmap(nullptr, File.m_Size, PROT_READ, MAP_SHARED, File.m_Fd, 0);
+			if (p == MAP_FAILED)
+				fail("can not map", fileName);
+			File.m_pData = static_cast<uint8_t*>(p);
+		}
+		return File;
+	}
+
+	void MappedFile::adviseSequential()
+	{
+		if (m_pData)
+			::madvise(m_pData, m_Size, MADV_SEQUENTIAL);
+	}
+
+	void MappedFile::flush()
+	{
+		if (m_pData && m_Writable)
+			::msync(m_pData, m_Size, MS_SYNC);
+	}
+
+	void MappedFile::close()
+	{
+		if (m_pData)
+			::munmap(m_pData, m_Size);
+		if (m_Fd >= 0)
+			::close(m_Fd);
+		m_pData = nullptr;
+		m_Fd = -1;
+		m_Size = 0;
+	}
+#endif
+}
@@ -0,0 +1,547 @@
+#include <algorithm>
+#include <math.h>
+
+#include "MotionKernel.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define POSGEN_X86_SIMD 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#include <immintrin.h>
+// msvc accepts all intrinsics without per function target
+#define POSGEN_TARGET(isa)
+#else
+#include <cpuid.h>
+#include <immintrin.h>
+// compile single functions for the wider instruction sets, the rest of the library stays generic
+#define POSGEN_TARGET(isa) __attribute__((target(isa)))
+#endif
+#endif
+
+// avx512f implies fma, fused multiply-add would change the rounding compared to the scalar path
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off")
+// gcc 12 reports false positives inside its own avx512 headers
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace PositionGenerator
+{
+	namespace
+	{
+		// same constants as used by the original per sensor implementation
+		constexpr float minNorm = 1E-20f;
+		constexpr float minTime = 1.E-20f;
+		constexpr float safety = 0.001f;
+
+		void advanceScalar(const MotionBatch& B, const MotionLimits& L, std::size_t first, std::size_t last)
+		{
+			for (std::size_t i = first; i < last; ++i)
+			{
+				const float timeInSec = B.timeInSec[i];
+				const float maxDistance = L.maxVelocity * timeInSec;
+				// some experimentation shows best results with 2.f
+				// too big and there seems to be now real movement
+				// too small and all sensor end up at the border
+				const float maxAccelaration = maxDistance * 2.f;
+				const float accFactor = B.randAcc[i] * maxAccelaration;
+
+				// normalized direction in the x/y plane
+				float dirX = B.randDirX[i] - 0.5f;
+				float dirY = B.randDirY[i] - 0.5f;
+				float scProd = dirX * dirX + dirY * dirY + 0.f * 0.f;
+				if (scProd > minNorm)
+				{
+					float dist = sqrtf(scProd);
+					dirX /= dist;
+					dirY /= dist;
+				}
+				else
+				{
+					dirX = dirY = 0.f;
+				}
+
+				float moveX = B.veloX[i] + dirX * accFactor;
+				float moveY = B.veloY[i] + dirY * accFactor;
+				float moveZ = B.veloZ[i] + 0.f * accFactor;
+
+				// now make sure, that move is less or equal to maxVelocity
+				float resultingVelo = sqrtf(moveX * moveX + moveY * moveY + moveZ * moveZ);
+				if (resultingVelo > maxDistance)
+				{
+					// if we just use maxDistance/resultingVelo as factor, we end up with rounding errors above maxDistance
+					// which will fail our tests, thats why we introduce a safety factor
+					float scale = (maxDistance - safety) / resultingVelo;
+					moveX = moveX * scale;
+					moveY = moveY * scale;
+					moveZ = moveZ * scale;
+				}
+
+				float newX = std::clamp(B.posX[i] + moveX, L.minValues.x(), L.maxValues.x());
+				float newY = std::clamp(B.posY[i] + moveY, L.minValues.y(), L.maxValues.y());
+				float newZ = std::clamp(B.posZ[i] + moveZ, L.minValues.z(), L.maxValues.z());
+
+				if (timeInSec > minTime)
+				{
+					float invTime = 1 / timeInSec;
+					B.veloX[i] = (newX - B.posX[i]) * invTime;
+					B.veloY[i] = (newY - B.posY[i]) * invTime;
+					B.veloZ[i] = (newZ - B.posZ[i]) * invTime;
+				}
+				B.posX[i] = newX;
+				B.posY[i] = newY;
+				B.posZ[i] = newZ;
+			}
+		}
+
+		void noiseScalar(const NoiseBatch& B, std::size_t first, std::size_t last)
+		{
+			for (std::size_t i = first; i < last; ++i)
+			{
+				const float noiseIntensity = B.randIntensity[i] * B.noiseDimension;
+				float dirX = B.randDirX[i] - 0.5f;
+				float dirY = B.randDirY[i] - 0.5f;
+				float scProd = dirX * dirX + dirY * dirY + 0.f * 0.f;
+				if (scProd > minNorm)
+				{
+					float dist = sqrtf(scProd);
+					dirX /= dist;
+					dirY /= dist;
+				}
+				else
+				{
+					dirX = dirY = 0.f;
+				}
+				B.outX[i] = B.posX[i] + dirX * noiseIntensity;
+				B.outY[i] = B.posY[i] + dirY * noiseIntensity;
+			}
+		}
+
+		void uniformScalar(const RandomBatch& B, std::size_t first, std::size_t last)
+		{
+			for (std::size_t i = first; i < last; ++i)
+			{
+				const Philox4x32::Counter_t ctr{
+					static_cast<uint32_t>(B.ticks[i]), static_cast<uint32_t>(B.ticks[i] >> 32),
+					static_cast<uint32_t>(B.sensorIds[i]), static_cast<uint32_t>(B.sensorIds[i] >> 32) };
+				const auto bits = Philox4x32::generate(ctr, B.key);
+				B.out0[i] = CounterRandom::toUnitFloat(bits[0]);
+				B.out1[i] = CounterRandom::toUnitFloat(bits[1]);
+				B.out2[i] = CounterRandom::toUnitFloat(bits[2]);
+			}
+		}
+
+#ifdef POSGEN_X86_SIMD
+		POSGEN_TARGET("avx2")
+		void advanceAVX2(const MotionBatch& B, const MotionLimits& L)
+		{
+			constexpr std::size_t width = 8;
+			const std::size_t vecEnd = B.count - B.count % width;
+
+			const __m256 maxVelo = _mm256_set1_ps(L.maxVelocity);
+			const __m256 two = _mm256_set1_ps(2.f);
+			const __m256 half = _mm256_set1_ps(0.5f);
+			const __m256 zero = _mm256_setzero_ps();
+			const __m256 one = _mm256_set1_ps(1.f);
+			const __m256 vMinNorm = _mm256_set1_ps(minNorm);
+			const __m256 vMinTime = _mm256_set1_ps(minTime);
+			const __m256 vSafety = _mm256_set1_ps(safety);
+			const __m256 minX = _mm256_set1_ps(L.minValues.x());
+			const __m256 minY = _mm256_set1_ps(L.minValues.y());
+			const __m256 minZ = _mm256_set1_ps(L.minValues.z());
+			const __m256 maxX = _mm256_set1_ps(L.maxValues.x());
+			const __m256 maxY = _mm256_set1_ps(L.maxValues.y());
+			const __m256 maxZ = _mm256_set1_ps(L.maxValues.z());
+
+			for (std::size_t i = 0; i < vecEnd; i += width)
+			{
+				const __m256 timeInSec = _mm256_loadu_ps(B.timeInSec + i);
+				const __m256 maxDistance = _mm256_mul_ps(maxVelo, timeInSec);
+				const __m256 accFactor = _mm256_mul_ps(_mm256_loadu_ps(B.randAcc + i), _mm256_mul_ps(maxDistance, two));
+
+				__m256 dirX = _mm256_sub_ps(_mm256_loadu_ps(B.randDirX + i), half);
+				__m256 dirY = _mm256_sub_ps(_mm256_loadu_ps(B.randDirY + i), half);
+				const __m256 scProd = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dirX, dirX), _mm256_mul_ps(dirY, dirY)), zero);
+				const __m256 dist = _mm256_sqrt_ps(scProd);
+				const __m256 validDir = _mm256_cmp_ps(scProd, vMinNorm, _CMP_GT_OQ);
+				dirX = _mm256_and_ps(validDir, _mm256_div_ps(dirX, dist));
+				dirY = _mm256_and_ps(validDir, _mm256_div_ps(dirY, dist));
+
+				const __m256 posX = _mm256_loadu_ps(B.posX + i);
+				const __m256 posY = _mm256_loadu_ps(B.posY + i);
+				const __m256 posZ = _mm256_loadu_ps(B.posZ + i);
+				__m256 moveX = _mm256_add_ps(_mm256_loadu_ps(B.veloX + i), _mm256_mul_ps(dirX, accFactor));
+				__m256 moveY = _mm256_add_ps(_mm256_loadu_ps(B.veloY + i), _mm256_mul_ps(dirY, accFactor));
+				__m256 moveZ = _mm256_add_ps(_mm256_loadu_ps(B.veloZ + i), _mm256_mul_ps(zero, accFactor));
+
+				const __m256 resultingVelo = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(
+					_mm256_mul_ps(moveX, moveX), _mm256_mul_ps(moveY, moveY)), _mm256_mul_ps(moveZ, moveZ)));
+				const __m256 tooFast = _mm256_cmp_ps(resultingVelo, maxDistance, _CMP_GT_OQ);
+				const __m256 scale = _mm256_blendv_ps(one, _mm256_div_ps(_mm256_sub_ps(maxDistance, vSafety), resultingVelo), tooFast);
+				moveX = _mm256_blendv_ps(moveX, _mm256_mul_ps(moveX, scale), tooFast);
+				moveY = _mm256_blendv_ps(moveY, _mm256_mul_ps(moveY, scale), tooFast);
+				moveZ = _mm256_blendv_ps(moveZ, _mm256_mul_ps(moveZ, scale), tooFast);
+
+				const __m256 newX = _mm256_min_ps(_mm256_max_ps(_mm256_add_ps(posX, moveX), minX), maxX);
+				const __m256 newY = _mm256_min_ps(_mm256_max_ps(_mm256_add_ps(posY, moveY), minY), maxY);
+				const __m256 newZ = _mm256_min_ps(_mm256_max_ps(_mm256_add_ps(posZ, moveZ), minZ), maxZ);
+
+				const __m256 validTime = _mm256_cmp_ps(timeInSec, vMinTime, _CMP_GT_OQ);
+				const __m256 invTime = _mm256_div_ps(one, timeInSec);
+				_mm256_storeu_ps(B.veloX + i, _mm256_blendv_ps(_mm256_loadu_ps(B.veloX + i), _mm256_mul_ps(_mm256_sub_ps(newX, posX), invTime), validTime));
+				_mm256_storeu_ps(B.veloY + i, _mm256_blendv_ps(_mm256_loadu_ps(B.veloY + i), _mm256_mul_ps(_mm256_sub_ps(newY, posY), invTime), validTime));
+				_mm256_storeu_ps(B.veloZ + i, _mm256_blendv_ps(_mm256_loadu_ps(B.veloZ + i), _mm256_mul_ps(_mm256_sub_ps(newZ, posZ), invTime), validTime));
+				_mm256_storeu_ps(B.posX + i, newX);
+				_mm256_storeu_ps(B.posY + i, newY);
+				_mm256_storeu_ps(B.posZ + i, newZ);
+			}
+			advanceScalar(B, L, vecEnd, B.count);
+		}
+
+		POSGEN_TARGET("avx512f")
+		void advanceAVX512(const MotionBatch& B, const MotionLimits& L)
+		{
+			constexpr std::size_t width = 16;
+			const std::size_t vecEnd = B.count - B.count % width;
+
+			const __m512 maxVelo = _mm512_set1_ps(L.maxVelocity);
+			const __m512 two = _mm512_set1_ps(2.f);
+			const __m512 half = _mm512_set1_ps(0.5f);
+			const __m512 zero = _mm512_setzero_ps();
+			const __m512 one = _mm512_set1_ps(1.f);
+			const __m512 vMinNorm = _mm512_set1_ps(minNorm);
+			const __m512 vMinTime = _mm512_set1_ps(minTime);
+			const __m512 vSafety = _mm512_set1_ps(safety);
+			const __m512 minX = _mm512_set1_ps(L.minValues.x());
+			const __m512 minY = _mm512_set1_ps(L.minValues.y());
+			const __m512 minZ = _mm512_set1_ps(L.minValues.z());
+			const __m512 maxX = _mm512_set1_ps(L.maxValues.x());
+			const __m512 maxY = _mm512_set1_ps(L.maxValues.y());
+			const __m512 maxZ = _mm512_set1_ps(L.maxValues.z());
+
+			for (std::size_t i = 0; i < vecEnd; i += width)
+			{
+				const __m512 timeInSec = _mm512_loadu_ps(B.timeInSec + i);
+				const __m512 maxDistance = _mm512_mul_ps(maxVelo, timeInSec);
+				const __m512 accFactor = _mm512_mul_ps(_mm512_loadu_ps(B.randAcc + i), _mm512_mul_ps(maxDistance, two));
+
+				__m512 dirX = _mm512_sub_ps(_mm512_loadu_ps(B.randDirX + i), half);
+				__m512 dirY = _mm512_sub_ps(_mm512_loadu_ps(B.randDirY + i), half);
+				const __m512 scProd = _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(dirX, dirX), _mm512_mul_ps(dirY, dirY)), zero);
+				const __m512 dist = _mm512_sqrt_ps(scProd);
+				const __mmask16 validDir = _mm512_cmp_ps_mask(scProd, vMinNorm, _CMP_GT_OQ);
+				dirX = _mm512_maskz_div_ps(validDir, dirX, dist);
+				dirY = _mm512_maskz_div_ps(validDir, dirY, dist);
+
+				const __m512 posX = _mm512_loadu_ps(B.posX + i);
+				const __m512 posY = _mm512_loadu_ps(B.posY + i);
+				const __m512 posZ = _mm512_loadu_ps(B.posZ + i);
+				__m512 moveX = _mm512_add_ps(_mm512_loadu_ps(B.veloX + i), _mm512_mul_ps(dirX, accFactor));
+				__m512 moveY = _mm512_add_ps(_mm512_loadu_ps(B.veloY + i), _mm512_mul_ps(dirY, accFactor));
+				__m512 moveZ = _mm512_add_ps(_mm512_loadu_ps(B.veloZ + i), _mm512_mul_ps(zero, accFactor));
+
+				const __m512 resultingVelo = _mm512_sqrt_ps(_mm512_add_ps(_mm512_add_ps(
+					_mm512_mul_ps(moveX, moveX), _mm512_mul_ps(moveY, moveY)), _mm512_mul_ps(moveZ, moveZ)));
+				const __mmask16 tooFast = _mm512_cmp_ps_mask(resultingVelo, maxDistance, _CMP_GT_OQ);
+				const __m512 scale = _mm512_mask_div_ps(one, tooFast, _mm512_sub_ps(maxDistance, vSafety), resultingVelo);
+				moveX = _mm512_mask_mul_ps(moveX, tooFast, moveX, scale);
+				moveY = _mm512_mask_mul_ps(moveY, tooFast, moveY, scale);
+				moveZ = _mm512_mask_mul_ps(moveZ, tooFast, moveZ, scale);
+
+				const __m512 newX = _mm512_min_ps(_mm512_max_ps(_mm512_add_ps(posX, moveX), minX), maxX);
+				const __m512 newY = _mm512_min_ps(_mm512_max_ps(_mm512_add_ps(posY, moveY), minY), maxY);
+				const __m512 newZ = _mm512_min_ps(_mm512_max_ps(_mm512_add_ps(posZ, moveZ), minZ), maxZ);
+
+				const __mmask16 validTime = _mm512_cmp_ps_mask(timeInSec, vMinTime, _CMP_GT_OQ);
+				const __m512 invTime = _mm512_div_ps(one, timeInSec);
+				_mm512_storeu_ps(B.veloX + i, _mm512_mask_mul_ps(_mm512_loadu_ps(B.veloX + i), validTime, _mm512_sub_ps(newX, posX), invTime));
+				_mm512_storeu_ps(B.veloY + i, _mm512_mask_mul_ps(_mm512_loadu_ps(B.veloY + i), validTime, _mm512_sub_ps(newY, posY), invTime));
+				_mm512_storeu_ps(B.veloZ + i, _mm512_mask_mul_ps(_mm512_loadu_ps(B.veloZ + i), validTime, _mm512_sub_ps(newZ, posZ), invTime));
+				_mm512_storeu_ps(B.posX + i, newX);
+				_mm512_storeu_ps(B.posY + i, newY);
+				_mm512_storeu_ps(B.posZ + i, newZ);
+			}
+			advanceScalar(B, L, vecEnd, B.count);
+		}
+
+		POSGEN_TARGET("avx2")
+		void noiseAVX2(const NoiseBatch& B)
+		{
+			constexpr std::size_t width = 8;
+			const std::size_t vecEnd = B.count - B.count % width;
+			const __m256 noiseDimension = _mm256_set1_ps(B.noiseDimension);
+			const __m256 half = _mm256_set1_ps(0.5f);
+			const __m256 zero = _mm256_setzero_ps();
+			const __m256 vMinNorm = _mm256_set1_ps(minNorm);
+			for (std::size_t i = 0; i < vecEnd; i += width)
+			{
+				const __m256 noiseIntensity = _mm256_mul_ps(_mm256_loadu_ps(B.randIntensity + i), noiseDimension);
+				__m256 dirX = _mm256_sub_ps(_mm256_loadu_ps(B.randDirX + i), half);
+				__m256 dirY = _mm256_sub_ps(_mm256_loadu_ps(B.randDirY + i), half);
+				const __m256 scProd = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dirX, dirX), _mm256_mul_ps(dirY, dirY)), zero);
+				const __m256 dist = _mm256_sqrt_ps(scProd);
+				const __m256 validDir = _mm256_cmp_ps(scProd, vMinNorm, _CMP_GT_OQ);
+				dirX = _mm256_and_ps(validDir, _mm256_div_ps(dirX, dist));
+				dirY = _mm256_and_ps(validDir, _mm256_div_ps(dirY, dist));
+				_mm256_storeu_ps(B.outX + i, _mm256_add_ps(_mm256_loadu_ps(B.posX + i), _mm256_mul_ps(dirX, noiseIntensity)));
+				_mm256_storeu_ps(B.outY + i, _mm256_add_ps(_mm256_loadu_ps(B.posY + i), _mm256_mul_ps(dirY, noiseIntensity)));
+			}
+			noiseScalar(B, vecEnd, B.count);
+		}
+
+		POSGEN_TARGET("avx512f")
+		void noiseAVX512(const NoiseBatch& B)
+		{
+			constexpr std::size_t width = 16;
+			const std::size_t vecEnd = B.count - B.count % width;
+			const __m512 noiseDimension = _mm512_set1_ps(B.noiseDimension);
+			const __m512 half = _mm512_set1_ps(0.5f);
+			const __m512 zero = _mm512_setzero_ps();
+			const __m512 vMinNorm = _mm512_set1_ps(minNorm);
+			for (std::size_t i = 0; i < vecEnd; i += width)
+			{
+				const __m512 noiseIntensity = _mm512_mul_ps(_mm512_loadu_ps(B.randIntensity + i), noiseDimension);
+				__m512 dirX = _mm512_sub_ps(_mm512_loadu_ps(B.randDirX + i), half);
+				__m512 dirY = _mm512_sub_ps(_mm512_loadu_ps(B.randDirY + i), half);
+				const __m512 scProd = _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(dirX, dirX), _mm512_mul_ps(dirY, dirY)), zero);
+				const __m512 dist = _mm512_sqrt_ps(scProd);
+				const __mmask16 validDir = _mm512_cmp_ps_mask(scProd, vMinNorm, _CMP_GT_OQ);
+				dirX = _mm512_maskz_div_ps(validDir, dirX, dist);
+				dirY = _mm512_maskz_div_ps(validDir, dirY, dist);
+				_mm512_storeu_ps(B.outX + i, _mm512_add_ps(_mm512_loadu_ps(B.posX + i), _mm512_mul_ps(dirX, noiseIntensity)));
+				_mm512_storeu_ps(B.outY + i, _mm512_add_ps(_mm512_loadu_ps(B.posY + i), _mm512_mul_ps(dirY, noiseIntensity)));
+			}
+			noiseScalar(B, vecEnd, B.count);
+		}
+
+		// Philox constants, see Philox4x32::generate
+		constexpr uint32_t philoxM0 = 0xD2511F53u;
+		constexpr uint32_t philoxM1 = 0xCD9E8D57u;
+		constexpr uint32_t philoxW0 = 0x9E3779B9u;
+		constexpr uint32_t philoxW1 = 0xBB67AE85u;
+		constexpr float unitFloatScale = 1.f / 16777216.f;
+
+		// 32x32 -> 64 bit products of all lanes, mul_epu32 only handles the even lanes
+		POSGEN_TARGET("avx2")
+		void mulHiLoAVX2(__m256i a, __m256i m, __m256i& hi, __m256i& lo)
+		{
+			const __m256i even = _mm256_mul_epu32(a, m);
+			const __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), m);
+			lo = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+			hi = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+		}
+
+		// splits 8 uint64 into their lower and upper 32 bits
+		POSGEN_TARGET("avx2")
+		void splitAVX2(const uint64_t* p, __m256i& lo, __m256i& hi)
+		{
+			const __m256i order = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+			const __m256i a = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), order);
+			const __m256i b = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 4)), order);
+			lo = _mm256_permute2x128_si256(a, b, 0x20);
+			hi = _mm256_permute2x128_si256(a, b, 0x31);
+		}
+
+		POSGEN_TARGET("avx2")
+		void uniformAVX2(const RandomBatch& B)
+		{
+			constexpr std::size_t width = 8;
+			const std::size_t vecEnd = B.count - B.count % width;
+			const __m256i m0 = _mm256_set1_epi32(static_cast<int>(philoxM0));
+			const __m256i m1 = _mm256_set1_epi32(static_cast<int>(philoxM1));
+			const __m256 scale = _mm256_set1_ps(unitFloatScale);
+			for (std::size_t i = 0; i < vecEnd; i += width)
+			{
+				__m256i ctr0, ctr1, ctr2, ctr3;
+				splitAVX2(B.ticks + i, ctr0, ctr1);
+				splitAVX2(B.sensorIds + i, ctr2, ctr3);
+				uint32_t key0 = B.key[0];
+				uint32_t key1 = B.key[1];
+				for (int round = 0; round < 10; ++round)
+				{
+					if (round > 0)
+					{
+						key0 += philoxW0;
+						key1 += philoxW1;
+					}
+					__m256i hi0, lo0, hi1, lo1;
+					mulHiLoAVX2(ctr0, m0, hi0, lo0);
+					mulHiLoAVX2(ctr2, m1, hi1, lo1);
+					ctr0 = _mm256_xor_si256(_mm256_xor_si256(hi1, ctr1), _mm256_set1_epi32(static_cast<int>(key0)));
+					ctr1 = lo1;
+					ctr2 = _mm256_xor_si256(_mm256_xor_si256(hi0, ctr3), _mm256_set1_epi32(static_cast<int>(key1)));
+					ctr3 = lo0;
+				}
+				// upper 24 bits fit into the positive int range, so the signed conversion is exact
+				_mm256_storeu_ps(B.out0 + i, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(ctr0, 8)), scale));
+				_mm256_storeu_ps(B.out1 + i, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(ctr1, 8)), scale));
+				_mm256_storeu_ps(B.out2 + i, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(ctr2, 8)), scale));
+			}
+			uniformScalar(B, vecEnd, B.count);
+		}
+
+		POSGEN_TARGET("avx512f")
+		void mulHiLoAVX512(__m512i a, __m512i m, __m512i& hi, __m512i& lo)
+		{
+			const __m512i even = _mm512_mul_epu32(a, m);
+			const __m512i odd = _mm512_mul_epu32(_mm512_srli_epi64(a, 32), m);
+			lo = _mm512_mask_blend_epi32(0xAAAA, even, _mm512_slli_epi64(odd, 32));
+			hi = _mm512_mask_blend_epi32(0xAAAA, _mm512_srli_epi64(even, 32), odd);
+		}
+
+		POSGEN_TARGET("avx512f")
+		void splitAVX512(const uint64_t* p, __m512i& lo, __m512i& hi)
+		{
+			const __m512i evenIdx = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+			const __m512i oddIdx = _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+			const __m512i a = _mm512_loadu_si512(p);
+			const __m512i b = _mm512_loadu_si512(p + 8);
+			lo = _mm512_permutex2var_epi32(a, evenIdx, b);
+			hi = _mm512_permutex2var_epi32(a, oddIdx, b);
+		}
+
+		POSGEN_TARGET("avx512f")
+		void uniformAVX512(const RandomBatch& B)
+		{
+			constexpr std::size_t width = 16;
+			const std::size_t vecEnd = B.count - B.count % width;
+			const __m512i m0 = _mm512_set1_epi32(static_cast<int>(philoxM0));
+			const __m512i m1 = _mm512_set1_epi32(static_cast<int>(philoxM1));
+			const __m512 scale = _mm512_set1_ps(unitFloatScale);
+			for (std::size_t i = 0; i < vecEnd; i += width)
+			{
+				__m512i ctr0, ctr1, ctr2, ctr3;
+				splitAVX512(B.ticks + i, ctr0, ctr1);
+				splitAVX512(B.sensorIds + i, ctr2, ctr3);
+				uint32_t key0 = B.key[0];
+				uint32_t key1 = B.key[1];
+				for (int round = 0; round < 10; ++round)
+				{
+					if (round > 0)
+					{
+						key0 += philoxW0;
+						key1 += philoxW1;
+					}
+					__m512i hi0, lo0, hi1, lo1;
+					mulHiLoAVX512(ctr0, m0, hi0, lo0);
+					mulHiLoAVX512(ctr2, m1, hi1, lo1);
+					ctr0 = _mm512_xor_si512(_mm512_xor_si512(hi1, ctr1), _mm512_set1_epi32(static_cast<int>(key0)));
+					ctr1 = lo1;
+					ctr2 = _mm512_xor_si512(_mm512_xor_si512(hi0, ctr3), _mm512_set1_epi32(static_cast<int>(key1)));
+					ctr3 = lo0;
+				}
+				_mm512_storeu_ps(B.out0 + i, _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_srli_epi32(ctr0, 8)), scale));
+				_mm512_storeu_ps(B.out1 + i, _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_srli_epi32(ctr1, 8)), scale));
+				_mm512_storeu_ps(B.out2 + i, _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_srli_epi32(ctr2, 8)), scale));
+			}
+			uniformScalar(B, vecEnd, B.count);
+		}
+
+		bool cpuSupports(SimdLevel level)
+		{
+#if defined(_MSC_VER)
+			int info[4];
+			__cpuid(info, 0);
+			if (info[0] < 7)
+				return false;
+			__cpuid(info, 1);
+			const bool osxsave = (info[2] & (1 << 27)) != 0;
+			const bool avx = (info[2] & (1 << 28)) != 0;
+			if (!osxsave || !avx)
+				return false;
+			// operating system has to save the ymm (and zmm) registers on context switch
+			const unsigned long long xcr0 = _xgetbv(0);
+			__cpuidex(info, 7, 0);
+			if (level == SimdLevel::AVX2)
+				return (xcr0 & 0x6) == 0x6 && (info[1] & (1 << 5)) != 0;
+			if (level == SimdLevel::AVX512)
+				return (xcr0 & 0xE6) == 0xE6 && (info[1] & (1 << 16)) != 0;
+			return false;
+#else
+			__builtin_cpu_init();
+			if (level == SimdLevel::AVX2)
+				return __builtin_cpu_supports("avx2");
+			if (level == SimdLevel::AVX512)
+				return __builtin_cpu_supports("avx512f");
+			return false;
+#endif
+		}
+#endif
+	}
+
+	bool isSimdLevelSupported(SimdLevel level)
+	{
+		if (level == SimdLevel::Scalar)
+			return true;
+#ifdef POSGEN_X86_SIMD
+		static const bool hasAVX2 = cpuSupports(SimdLevel::AVX2);
+		static const bool hasAVX512 = cpuSupports(SimdLevel::AVX512);
+		return level == SimdLevel::AVX512 ? hasAVX512 : hasAVX2;
+#else
+		return false;
+#endif
+	}
+
+	SimdLevel detectSimdLevel()
+	{
+		static const SimdLevel detected = []()
+		{
+			if (isSimdLevelSupported(SimdLevel::AVX512))
+				return SimdLevel::AVX512;
+			if (isSimdLevelSupported(SimdLevel::AVX2))
+				return SimdLevel::AVX2;
+			return SimdLevel::Scalar;
+		}();
+		return detected;
+	}
+
+	const char* simdLevelName(SimdLevel level)
+	{
+		switch (level)
+		{
+		case SimdLevel::AVX2: return "AVX2";
+		case SimdLevel::AVX512: return "AVX-512";
+		default: return "scalar";
+		}
+	}
+
+	void advanceSensors(const MotionBatch& Batch, const MotionLimits& Limits)
+	{
+		advanceSensors(Batch, Limits, detectSimdLevel());
+	}
+
+	void advanceSensors(const MotionBatch& Batch, const MotionLimits& Limits, SimdLevel level)
+	{
+#ifdef POSGEN_X86_SIMD
+		if (level == SimdLevel::AVX512 && isSimdLevelSupported(level))
+			return advanceAVX512(Batch, Limits);
+		if (level == SimdLevel::AVX2 && isSimdLevelSupported(level))
+			return advanceAVX2(Batch, Limits);
+#endif
+		advanceScalar(Batch, Limits, 0, Batch.count);
+	}
+
+	void applyNoise(const NoiseBatch& Batch, SimdLevel level)
+	{
+#ifdef POSGEN_X86_SIMD
+		if (level == SimdLevel::AVX512 && isSimdLevelSupported(level))
+			return noiseAVX512(Batch);
+		if (level == SimdLevel::AVX2 && isSimdLevelSupported(level))
+			return noiseAVX2(Batch);
+#endif
+		noiseScalar(Batch, 0, Batch.count);
+	}
+
+	void uniformBatch(const RandomBatch& Batch, SimdLevel level)
+	{
+#ifdef POSGEN_X86_SIMD
+		if (level == SimdLevel::AVX512 && isSimdLevelSupported(level))
+			return uniformAVX512(Batch);
+		if (level == SimdLevel::AVX2 && isSimdLevelSupported(level))
+			return uniformAVX2(Batch);
+#endif
+		uniformScalar(Batch, 0, Batch.count);
+	}
+}
@@ -0,0 +1,159 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "PositionCodec.h"
+
+namespace PositionGenerator
+{
+	namespace
+	{
+		// largest float below 2^31, positions beyond saturate instead of overflowing
+		constexpr float MaxQuantized = 2147483520.f;
+
+		// std::max returns its first argument if a comparison with NaN fails, so NaN ends up at -MaxQuantized
+		// instead of an undefined conversion (std::clamp would pass NaN through)
+		int32_t quantize(float value, float invResolution)
+		{
+			const float scaled = std::min(std::max(-MaxQuantized, std::nearbyint(value * invResolution)), MaxQuantized);
+			return static_cast<int32_t>(scaled);
+		}
+
+		void quantizeColumn(std::size_t count, const float* In, float invResolution, int32_t* Out)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+				Out[i] = quantize(In[i], invResolution);
+		}
+
+		// differences wrap around like the decoder's sums, so even saturated values round trip
+		void deltaColumn(std::size_t count, const uint32_t* Slots, int32_t* Current, int32_t* Previous)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				const int32_t value = Current[i];
+				int32_t& previous = Previous[Slots[i]];
+				Current[i] = static_cast<int32_t>(static_cast<uint32_t>(value) - static_cast<uint32_t>(previous));
+				previous = value;
+			}
+		}
+
+		void storeColumn(std::size_t count, const uint32_t* Slots, const int32_t* Current, int32_t* Previous)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+				Previous[Slots[i]] = Current[i];
+		}
+	}
+
+	PositionEncoder::PositionEncoder(float resolution, uint32_t keyframeInterval)
+		: m_Resolution(resolution), m_InvResolution(1.f / resolution)
+		, m_KeyframeInterval(std::max<uint32_t>(keyframeInterval, 1))
+	{
+		if (!(resolution > 0.f))
+			throw std::invalid_argument("PositionEncoder: resolution has to be positive");
+	}
+
+	void PositionEncoder::encode(const TickSnapshot& Snapshot, EncodedTick& Out)
+	{
+		const std::size_t numSensors = Snapshot.size();
+		Out.resize(numSensors);
+		Out.resolution = m_Resolution;
+		Out.tickTimestamp = Snapshot.tickTimestamp;
+		std::copy_n(Snapshot.sensorIds.data(), numSensors, Out.sensorIds.data());
+		for (std::size_t i = 0; i < numSensors; ++i)
+			Out.timestampOffsets[i] = static_cast<int64_t>(Snapshot.timestamps[i] - Snapshot.tickTimestamp);
+
+		quantizeColumn(numSensors, Snapshot.x.data(), m_InvResolution, Out.x.data());
+		quantizeColumn(numSensors, Snapshot.y.data(), m_InvResolution, Out.y.data());
+		quantizeColumn(numSensors, Snapshot.z.data(), m_InvResolution, Out.z.data());
+
+		const bool newSensors = !sameSensors(Snapshot) && assignSlots(Snapshot);
+		const uint32_t* Slots = m_TickSlots.data();
+		bool keyframe = m_ForceKeyframe || newSensors;
+		for (std::size_t i = 0; i < numSensors && !keyframe; ++i)
+			keyframe = m_SinceKeyframe[Slots[i]] + 1 >= m_KeyframeInterval;
+		Out.keyframe = keyframe;
+		m_ForceKeyframe = false;
+
+		if (keyframe)
+		{
+			storeColumn(numSensors, Slots, Out.x.data(), m_X.data());
+			storeColumn(numSensors, Slots, Out.y.data(), m_Y.data());
+			storeColumn(numSensors, Slots, Out.z.data(), m_Z.data());
+			for (std::size_t i = 0; i < numSensors; ++i)
+				m_SinceKeyframe[Slots[i]] = 0;
+			return;
+		}
+		deltaColumn(numSensors, Slots, Out.x.data(), m_X.data());
+		deltaColumn(numSensors, Slots, Out.y.data(), m_Y.data());
+		deltaColumn(numSensors, Slots, Out.z.data(), m_Z.data());
+		for (std::size_t i = 0; i < numSensors; ++i)
+			++m_SinceKeyframe[Slots[i]];
+	}
+
+	bool PositionEncoder::sameSensors(const TickSnapshot& Snapshot) const
+	{
+		return Snapshot.size() == m_SensorIds.size()
+			&& std::equal(m_SensorIds.begin(), m_SensorIds.end(), Snapshot.sensorIds.begin());
+	}
+
+	bool PositionEncoder::assignSlots(const TickSnapshot& Snapshot)
+	{
+		const std::size_t numSensors = Snapshot.size();
+		m_SensorIds.assign(Snapshot.sensorIds.begin(), Snapshot.sensorIds.end());
+		m_TickSlots.resize(numSensors);
+		bool added = false;
+		for (std::size_t i = 0; i < numSensors; ++i)
+		{
+			auto [it, inserted] = m_Slots.try_emplace(Snapshot.sensorIds[i], static_cast<uint32_t>(m_X.size()));
+			if (inserted)
+			{
+				m_X.push_back(0);
+				m_Y.push_back(0);
+				m_Z.push_back(0);
+				m_SinceKeyframe.push_back(0);
+				added = true;
+			}
+			m_TickSlots[i] = it->second;
+		}
+		return added;
+	}
+
+	bool PositionDecoder::decode(const EncodedTick& Tick, TickSnapshot& Out)
+	{
+		const std::size_t numSensors = Tick.size();
+		const std::size_t first = Out.size();
+		Out.resize(first + numSensors);
+		Out.tickTimestamp = Tick.tickTimestamp;
+
+		bool complete = true;
+		std::size_t decoded = first;
+		for (std::size_t i = 0; i < numSensors; ++i)
+		{
+			const sensorId_t sensorId = Tick.sensorIds[i];
+			Quantized Value{ Tick.x[i], Tick.y[i], Tick.z[i] };
+			if (Tick.keyframe)
+				m_Last[sensorId] = Value;
+			else
+			{
+				auto it = m_Last.find(sensorId);
+				if (it == m_Last.end())
+				{
+					complete = false;
+					continue;
+				}
+				auto add = [](int32_t last, int32_t delta) { return static_cast<int32_t>(static_cast<uint32_t>(last) + static_cast<uint32_t>(delta)); };
+				Value = Quantized{ add(it->second.x, Value.x), add(it->second.y, Value.y), add(it->second.z, Value.z) };
+				it->second = Value;
+			}
+
+			Out.sensorIds[decoded] = sensorId;
+			Out.timestamps[decoded] = Tick.tickTimestamp + static_cast<timestamp_t>(Tick.timestampOffsets[i]);
+			Out.x[decoded] = static_cast<float>(Value.x) * Tick.resolution;
+			Out.y[decoded] = static_cast<float>(Value.y) * Tick.resolution;
+			Out.z[decoded] = static_cast<float>(Value.z) * Tick.resolution;
+			++decoded;
+		}
+		Out.resize(decoded);
+		return complete;
+	}
+}
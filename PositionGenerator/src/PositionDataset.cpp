@@ -0,0 +1,175 @@
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include "AlignedAllocator.h"
+#include "Generator.h"
+#include "PositionDataset.h"
+
+namespace PositionGenerator
+{
+	namespace
+	{
+		uint64_t alignUp(uint64_t value)
+		{
+			return (value + CacheLineSize - 1) / CacheLineSize * CacheLineSize;
+		}
+
+		constexpr uint64_t ColumnElementSize[static_cast<std::size_t>(DatasetColumn::Count)] = {
+			sizeof(sensorId_t), sizeof(timestamp_t), sizeof(float), sizeof(float), sizeof(float) };
+
+		// the block size of more records would overflow
+		constexpr uint64_t MaxRecords = std::numeric_limits<uint64_t>::max() / (4 * CacheLineSize);
+	}
+
+	DatasetHeader makeDatasetHeader(std::size_t numSensors, std::size_t maxTicks)
+	{
+		DatasetHeader Header;
+		std::memset(&Header, 0, sizeof(Header));
+		std::memcpy(Header.magic, DatasetMagic, sizeof(DatasetMagic));
+		Header.version = DatasetVersion;
+		Header.headerSize = sizeof(DatasetHeader);
+		Header.numSensors = numSensors;
+		Header.maxTicks = maxTicks;
+		Header.indexOffset = alignUp(sizeof(DatasetHeader));
+		Header.dataOffset = alignUp(Header.indexOffset + maxTicks * sizeof(TickIndexEntry));
+
+		uint64_t offset = 0;
+		for (std::size_t column = 0; column < static_cast<std::size_t>(DatasetColumn::Count); ++column)
+		{
+			Header.columnOffset[column] = offset;
+			offset = alignUp(offset + numSensors * ColumnElementSize[column]);
+		}
+		Header.blockSize = offset;
+		return Header;
+	}
+
+	DatasetWriter::DatasetWriter(const std::string& fileName, std::size_t numSensors, std::size_t maxTicks,
+		uint64_t timestampUnitsPerSecond, uint64_t seed)
+	{
+		DatasetHeader Header = makeDatasetHeader(numSensors, maxTicks);
+		Header.timestampUnitsPerSecond = timestampUnitsPerSecond;
+		Header.seed = seed;
+		m_File = MappedFile::create(fileName, Header.dataOffset + maxTicks * Header.blockSize);
+		std::memcpy(m_File.data(), &Header, sizeof(Header));
+	}
+
+	DatasetWriter::~DatasetWriter()
+	{
+		close();
+	}
+
+	SnapshotColumns DatasetWriter::appendTick(timestamp_t tickTimestamp)
+	{
+		DatasetHeader& Header = header();
+		if (Header.numTicks >= Header.maxTicks)
+			throw std::length_error("DatasetWriter: dataset is full");
+
+		const uint64_t blockOffset = Header.dataOffset + Header.numTicks * Header.blockSize;
+		auto* pIndex = reinterpret_cast<TickIndexEntry*>(m_File.data() + Header.indexOffset);
+		TickIndexEntry& Entry = pIndex[Header.numTicks];
+		Entry.tickTimestamp = tickTimestamp;
+		Entry.offset = blockOffset;
+		Entry.numRecords = Header.numSensors;
+		Entry.reserved = 0;
+		++Header.numTicks;
+
+		uint8_t* pBlock = m_File.data() + blockOffset;
+		SnapshotColumns Columns;
+		Columns.sensorIds = reinterpret_cast<sensorId_t*>(pBlock + Header.columnOffset[static_cast<std::size_t>(DatasetColumn::SensorId)]);
+		Columns.timestamps = reinterpret_cast<timestamp_t*>(pBlock + Header.columnOffset[static_cast<std::size_t>(DatasetColumn::Timestamp)]);
+		Columns.x = reinterpret_cast<float*>(pBlock + Header.columnOffset[static_cast<std::size_t>(DatasetColumn::X)]);
+		Columns.y = reinterpret_cast<float*>(pBlock + Header.columnOffset[static_cast<std::size_t>(DatasetColumn::Y)]);
+		Columns.z = reinterpret_cast<float*>(pBlock + Header.columnOffset[static_cast<std::size_t>(DatasetColumn::Z)]);
+		return Columns;
+	}
+
+	void DatasetWriter::close()
+	{
+		if (!m_File.isOpen())
+			return;
+		m_File.flush();
+		m_File.close();
+	}
+
+	DatasetReader::DatasetReader(const std::string& fileName)
+		: m_File(MappedFile::openReadOnly(fileName))
+	{
+		auto invalid = [&fileName](const char* what)
+		{
+			return std::runtime_error("DatasetReader: " + fileName + " " + what);
+		};
+		const uint64_t fileSize = m_File.size();
+		if (fileSize < sizeof(DatasetHeader))
+			throw invalid("is too small for a dataset");
+		const DatasetHeader& Header = header();
+		if (std::memcmp(Header.magic, DatasetMagic, sizeof(DatasetMagic)) != 0)
+			throw invalid("is no position dataset");
+		if (Header.version != DatasetVersion || Header.headerSize != sizeof(DatasetHeader))
+			throw invalid("has an unsupported version");
+
+		// the index has to fit into the file, and the sizes derived from the counts must not overflow
+		if (Header.maxTicks > (fileSize - sizeof(DatasetHeader)) / sizeof(TickIndexEntry))
+			throw invalid("is truncated");
+		if (Header.numSensors > MaxRecords)
+			throw invalid("has an inconsistent layout");
+
+		// the layout follows from the number of sensors and ticks
+		const DatasetHeader Expected = makeDatasetHeader(Header.numSensors, Header.maxTicks);
+		if (Header.indexOffset != Expected.indexOffset || Header.dataOffset != Expected.dataOffset
+			|| Header.blockSize != Expected.blockSize
+			|| std::memcmp(Header.columnOffset, Expected.columnOffset, sizeof(Header.columnOffset)) != 0)
+			throw invalid("has an inconsistent layout");
+		// without sensors the blocks are empty, all ticks point at the end of the index
+		if (Header.numTicks > Header.maxTicks || Header.dataOffset > fileSize
+			|| (Header.blockSize > 0 && Header.maxTicks > (fileSize - Header.dataOffset) / Header.blockSize))
+			throw invalid("is truncated");
+
+		const TickIndexEntry* pIndex = index();
+		for (uint64_t tick = 0; tick < Header.numTicks; ++tick)
+		{
+			const TickIndexEntry& Entry = pIndex[tick];
+			const bool misplaced = Header.blockSize > 0
+				? (Entry.offset - Header.dataOffset) % Header.blockSize != 0
+				: Entry.offset != Header.dataOffset;
+			if (Entry.numRecords > Header.numSensors || Entry.offset < Header.dataOffset
+				|| Entry.offset > fileSize - Header.blockSize || misplaced)
+				throw invalid("has a corrupt tick index");
+		}
+		// datasets are usually replayed front to back
+		m_File.adviseSequential();
+	}
+
+	DatasetTick DatasetReader::tick(std::size_t index) const
+	{
+		const DatasetHeader& Header = header();
+		const TickIndexEntry& Entry = this->index()[index];
+		DatasetTick Tick;
+		Tick.tickTimestamp = Entry.tickTimestamp;
+		Tick.numRecords = Entry.numRecords;
+		Tick.pIndexEntry = &Entry;
+		Tick.pBlock = m_File.data() + Entry.offset;
+		Tick.blockSize = Header.blockSize;
+		Tick.sensorIds = reinterpret_cast<const sensorId_t*>(Tick.pBlock + Header.columnOffset[static_cast<std::size_t>(DatasetColumn::SensorId)]);
+		Tick.timestamps = reinterpret_cast<const timestamp_t*>(Tick.pBlock + Header.columnOffset[static_cast<std::size_t>(DatasetColumn::Timestamp)]);
+		Tick.x = reinterpret_cast<const float*>(Tick.pBlock + Header.columnOffset[static_cast<std::size_t>(DatasetColumn::X)]);
+		Tick.y = reinterpret_cast<const float*>(Tick.pBlock + Header.columnOffset[static_cast<std::size_t>(DatasetColumn::Y)]);
+		Tick.z = reinterpret_cast<const float*>(Tick.pBlock + Header.columnOffset[static_cast<std::size_t>(DatasetColumn::Z)]);
+		return Tick;
+	}
+
+	std::size_t generateDataset(Generator& Gen, const std::string& fileName, std::size_t numTicks, timestamp_t tickInterval)
+	{
+		DatasetWriter Writer(fileName, Gen.sensors().size(), numTicks, Gen.parameter().timeStampPerSecond(), Gen.seed());
+		timestamp_t timestamp = Gen.currentTimestamp();
+		for (std::size_t tick = 0; tick < numTicks; ++tick)
+		{
+			timestamp += tickInterval;
+			Gen.generateData(timestamp);
+			Gen.captureSnapshot(Writer.appendTick(timestamp));
+		}
+		Writer.close();
+		const DatasetHeader Header = makeDatasetHeader(Gen.sensors().size(), numTicks);
+		return Header.dataOffset + numTicks * Header.blockSize;
+	}
+}
@@ -0,0 +1,106 @@
+#include "SensorStore.h"
+
+namespace PositionGenerator
+{
+	SensorStore::SensorStore(MemoryPolicy policy)
+		: m_SensorIds(AlignedAllocator<sensorId_t>(policy)), m_Timestamps(AlignedAllocator<timestamp_t>(policy))
+		, m_PosX(AlignedAllocator<float>(policy)), m_PosY(AlignedAllocator<float>(policy)), m_PosZ(AlignedAllocator<float>(policy))
+		, m_VeloX(AlignedAllocator<float>(policy)), m_VeloY(AlignedAllocator<float>(policy)), m_VeloZ(AlignedAllocator<float>(policy))
+	{
+	}
+
+	void SensorStore::reserve(std::size_t capacity)
+	{
+		m_SensorIds.reserve(capacity);
+		m_Timestamps.reserve(capacity);
+		m_PosX.reserve(capacity);
+		m_PosY.reserve(capacity);
+		m_PosZ.reserve(capacity);
+		m_VeloX.reserve(capacity);
+		m_VeloY.reserve(capacity);
+		m_VeloZ.reserve(capacity);
+	}
+
+	void SensorStore::clear()
+	{
+		m_SensorIds.clear();
+		m_Timestamps.clear();
+		m_PosX.clear();
+		m_PosY.clear();
+		m_PosZ.clear();
+		m_VeloX.clear();
+		m_VeloY.clear();
+		m_VeloZ.clear();
+	}
+
+	void SensorStore::touchCapacity(std::size_t first, std::size_t last)
+	{
+		touchCapacity(m_SensorIds, first, last);
+		touchCapacity(m_Timestamps, first, last);
+		touchCapacity(m_PosX, first, last);
+		touchCapacity(m_PosY, first, last);
+		touchCapacity(m_PosZ, first, last);
+		touchCapacity(m_VeloX, first, last);
+		touchCapacity(m_VeloY, first, last);
+		touchCapacity(m_VeloZ, first, last);
+	}
+
+	void SensorStore::push_back(const SensorPosition& Sensor)
+	{
+		auto Pos = Sensor.position();
+		auto Velo = Sensor.velocity();
+		m_SensorIds.push_back(Sensor.sensorId());
+		m_Timestamps.push_back(Sensor.timestamp());
+		m_PosX.push_back(Pos.x());
+		m_PosY.push_back(Pos.y());
+		m_PosZ.push_back(Pos.z());
+		m_VeloX.push_back(Velo.x());
+		m_VeloY.push_back(Velo.y());
+		m_VeloZ.push_back(Velo.z());
+	}
+
+	void SensorStore::eraseUnordered(std::size_t index)
+	{
+		const std::size_t last = size() - 1;
+		if (index != last)
+		{
+			m_SensorIds[index] = m_SensorIds[last];
+			m_Timestamps[index] = m_Timestamps[last];
+			m_PosX[index] = m_PosX[last];
+			m_PosY[index] = m_PosY[last];
+			m_PosZ[index] = m_PosZ[last];
+			m_VeloX[index] = m_VeloX[last];
+			m_VeloY[index] = m_VeloY[last];
+			m_VeloZ[index] = m_VeloZ[last];
+		}
+		m_SensorIds.pop_back();
+		m_Timestamps.pop_back();
+		m_PosX.pop_back();
+		m_PosY.pop_back();
+		m_PosZ.pop_back();
+		m_VeloX.pop_back();
+		m_VeloY.pop_back();
+		m_VeloZ.pop_back();
+	}
+
+	SensorPosition SensorStore::at(std::size_t index) const
+	{
+		SensorPosition Sensor(m_SensorIds[index], m_Timestamps[index], Vector3(m_PosX[index], m_PosY[index], m_PosZ[index]));
+		Sensor.setVelocity(Vector3(m_VeloX[index], m_VeloY[index], m_VeloZ[index]));
+		return Sensor;
+	}
+
+	void SensorStore::set(std::size_t index, const SensorPosition& Sensor)
+	{
+		auto Pos = Sensor.position();
+		auto Velo = Sensor.velocity();
+		m_SensorIds[index] = Sensor.sensorId();
+		m_Timestamps[index] = Sensor.timestamp();
+		m_PosX[index] = Pos.x();
+		m_PosY[index] = Pos.y();
+		m_PosZ[index] = Pos.z();
+		m_VeloX[index] = Velo.x();
+		m_VeloY[index] = Velo.y();
+		m_VeloZ[index] = Velo.z();
+	}
+}
@@ -0,0 +1,224 @@
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+#include "Settings.h"
+
+namespace PositionGenerator
+{
+	namespace
+	{
+		std::string trim(const std::string& Text)
+		{
+			auto isSpace = [](unsigned char c) { return std::isspace(c) != 0; };
+			auto first = std::find_if_not(Text.begin(), Text.end(), isSpace);
+			auto last = std::find_if_not(Text.rbegin(), Text.rend(), isSpace).base();
+			return first < last ? std::string(first, last) : std::string();
+		}
+
+		// the whole text has to be the number, "12m" is an error and not 12
+		template <typename T>
+		bool parseNumber(const std::string& Text, T& value)
+		{
+			const char* pEnd = Text.data() + Text.size();
+			auto Result = std::from_chars(Text.data(), pEnd, value);
+			return Result.ec == std::errc() && Result.ptr == pEnd;
+		}
+
+		[[noreturn]] void badValue(const std::string& key, const std::string& value, const char* expected)
+		{
+			throw std::invalid_argument("Settings: " + key + " = '" + value + "' is no " + expected);
+		}
+
+		// counts the parameter keeps as int, out of range values are errors instead of being truncated
+		int intInRange(const Settings& Config, const std::string& key, int defaultValue, int64_t minValue, const char* expected)
+		{
+			const int64_t value = Config.getInt(key, defaultValue);
+			if (value < minValue || value > std::numeric_limits<int>::max())
+				badValue(key, Config.getString(key, ""), expected);
+			return static_cast<int>(value);
+		}
+	}
+
+	void Settings::loadFile(const std::string& fileName)
+	{
+		std::ifstream In(fileName);
+		if (!In)
+			throw std::runtime_error("Settings: can not open " + fileName);
+		std::string Line;
+		for (int lineNumber = 1; std::getline(In, Line); ++lineNumber)
+		{
+			Line = trim(Line.substr(0, Line.find('#')));
+			if (Line.empty())
+				continue;
+			auto equal = Line.find('=');
+			if (equal == std::string::npos)
+				throw std::runtime_error("Settings: " + fileName + ":" + std::to_string(lineNumber) + " is no 'key = value' line");
+			set(trim(Line.substr(0, equal)), trim(Line.substr(equal + 1)));
+		}
+	}
+
+	void Settings::parseCommandLine(int argc, const char* const argv[])
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			std::string Option = argv[i];
+			if (Option.rfind("--", 0) != 0 || Option.size() == 2)
+				throw std::invalid_argument("Settings: expected --key instead of '" + Option + "'");
+			if (i + 1 >= argc)
+				throw std::invalid_argument("Settings: no value for " + Option);
+			const std::string key = Option.substr(2);
+			const std::string value = argv[++i];
+			if (key == "config")
+				loadFile(value);
+			else
+				set(key, value);
+		}
+	}
+
+	const std::string* Settings::find(const std::string& key) const
+	{
+		auto it = m_Values.find(key);
+		if (it == m_Values.end())
+			return nullptr;
+		m_Used.insert(key);
+		return &it->second;
+	}
+
+	std::string Settings::getString(const std::string& key, const std::string& defaultValue) const
+	{
+		const std::string* pValue = find(key);
+		return pValue ? *pValue : defaultValue;
+	}
+
+	double Settings::getDouble(const std::string& key, double defaultValue) const
+	{
+		const std::string* pValue = find(key);
+		if (!pValue)
+			return defaultValue;
+		double value = 0.;
+		if (!parseNumber(*pValue, value))
+			badValue(key, *pValue, "number");
+		return value;
+	}
+
+	int64_t Settings::getInt(const std::string& key, int64_t defaultValue) const
+	{
+		const std::string* pValue = find(key);
+		if (!pValue)
+			return defaultValue;
+		int64_t value = 0;
+		if (!parseNumber(*pValue, value))
+			badValue(key, *pValue, "integer");
+		return value;
+	}
+
+	uint64_t Settings::getUInt(const std::string& key, uint64_t defaultValue) const
+	{
+		const std::string* pValue = find(key);
+		if (!pValue)
+			return defaultValue;
+		uint64_t value = 0;
+		if (!parseNumber(*pValue, value))
+			badValue(key, *pValue, "unsigned integer");
+		return value;
+	}
+
+	bool Settings::getBool(const std::string& key, bool defaultValue) const
+	{
+		const std::string* pValue = find(key);
+		if (!pValue)
+			return defaultValue;
+		if (*pValue == "true" || *pValue == "yes" || *pValue == "on" || *pValue == "1")
+			return true;
+		if (*pValue == "false" || *pValue == "no" || *pValue == "off" || *pValue == "0")
+			return false;
+		badValue(key, *pValue, "boolean");
+	}
+
+	Vector3 Settings::getVector(const std::string& key, const Vector3& defaultValue) const
+	{
+		const std::string* pValue = find(key);
+		if (!pValue)
+			return defaultValue;
+		float coords[3] = {};
+		std::size_t begin = 0;
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			auto end = axis < 2 ? pValue->find(',', begin) : pValue->size();
+			if (end == std::string::npos || !parseNumber(trim(pValue->substr(begin, end - begin)), coords[axis]))
+				badValue(key, *pValue, "vector x,y,z");
+			begin = end + 1;
+		}
+		if (begin <= pValue->size())
+			badValue(key, *pValue, "vector x,y,z");
+		return Vector3(coords[0], coords[1], coords[2]);
+	}
+
+	std::vector<double> Settings::getList(const std::string& key, const std::vector<double>& defaultValue) const
+	{
+		const std::string* pValue = find(key);
+		if (!pValue)
+			return defaultValue;
+		std::vector<double> Values;
+		for (std::size_t begin = 0; begin <= pValue->size();)
+		{
+			auto end = std::min(pValue->find(',', begin), pValue->size());
+			double value = 0.;
+			if (!parseNumber(trim(pValue->substr(begin, end - begin)), value))
+				badValue(key, *pValue, "list of numbers");
+			Values.push_back(value);
+			begin = end + 1;
+		}
+		return Values;
+	}
+
+	std::vector<std::string> Settings::unusedKeys() const
+	{
+		std::vector<std::string> Keys;
+		for (const auto& Entry : m_Values)
+			if (m_Used.count(Entry.first) == 0)
+				Keys.push_back(Entry.first);
+		return Keys;
+	}
+
+	GenerationParameter generationParameter(const Settings& Config, const GenerationParameter& Defaults)
+	{
+		GenerationParameter Param(Defaults);
+		Param
+			.setNumOfSensors(intInRange(Config, "sensors", Defaults.numOfSensors(), 0, "sensor count"))
+			.setBoundingCuboid(Config.getVector("min", Defaults.minValues()), Config.getVector("max", Defaults.maxValues()))
+			.setMaximalVelocity(static_cast<float>(Config.getDouble("max-velocity", Defaults.maxVelocity())))
+			.setInitialTimestamp(Config.getUInt("initial-timestamp", Defaults.initialTimestamp()))
+			.setTimestampUnitPerSecond(Config.getUInt("timestamp-units-per-second", Defaults.timeStampPerSecond()))
+			.setNoiseDimension(static_cast<float>(Config.getDouble("noise", Defaults.noiseDimension())))
+			.setNumOfThreads(intInRange(Config, "threads", Defaults.numOfThreads(), 0, "thread count"))
+			.setShardSize(intInRange(Config, "shard-size", Defaults.shardSize(), 1, "shard size"))
+			.setGridCellSize(static_cast<float>(Config.getDouble("grid-cell-size", Defaults.gridCellSize())))
+			.setProximityRadius(static_cast<float>(Config.getDouble("proximity-radius", Defaults.proximityRadius())))
+			.setUpdateRates(Config.getList("update-rates", Defaults.updateRates()));
+
+		const std::string Random = Config.getString("random", "");
+		if (Random == "mersenne")
+			Param.setRandomPolicy(RandomPolicy::MersenneTwister);
+		else if (Random == "philox")
+			Param.setRandomPolicy(RandomPolicy::CounterBased);
+		else if (!Random.empty())
+			badValue("random", Random, "random policy (mersenne or philox)");
+
+		const std::string Memory = Config.getString("memory", "");
+		if (Memory == "default")
+			Param.setMemoryPolicy(MemoryPolicy::Default);
+		else if (Memory == "huge-pages")
+			Param.setMemoryPolicy(MemoryPolicy::HugePages);
+		else if (!Memory.empty())
+			badValue("memory", Memory, "memory policy (default or huge-pages)");
+
+		if (Config.has("seed"))
+			Param.setSeed(Config.getUInt("seed", 0));
+		return Param;
+	}
+}
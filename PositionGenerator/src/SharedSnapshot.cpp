@@ -0,0 +1,78 @@
+#include <stdexcept>
+
+#include "SharedSnapshot.h"
+
+namespace PositionGenerator
+{
+	SharedSnapshot::Reader& SharedSnapshot::Reader::operator=(Reader&& Other) noexcept
+	{
+		if (this != &Other)
+		{
+			release();
+			m_pOwner = Other.m_pOwner;
+			m_buffer = Other.m_buffer;
+			Other.m_pOwner = nullptr;
+		}
+		return *this;
+	}
+
+	void SharedSnapshot::Reader::release()
+	{
+		if (!m_pOwner)
+			return;
+		// release, the writer may reuse the buffer once it sees the count drop
+		m_pOwner->m_Buffers[m_buffer].readers.fetch_sub(1, std::memory_order_release);
+		m_pOwner = nullptr;
+	}
+
+	SharedSnapshot::SharedSnapshot(std::size_t numBuffers)
+		: m_Buffers(std::make_unique<Buffer[]>(numBuffers)), m_NumBuffers(numBuffers)
+	{
+		if (numBuffers < 2 || numBuffers >= NoBuffer)
+			throw std::invalid_argument("SharedSnapshot: needs at least 2 buffers");
+	}
+
+	TickSnapshot* SharedSnapshot::writeBuffer()
+	{
+		if (m_Writing != NoBuffer)
+			return &m_Buffers[m_Writing].Snapshot;
+		const std::size_t current = static_cast<std::size_t>(m_Current.load(std::memory_order_relaxed) >> IndexShift);
+		for (std::size_t i = 0; i < m_NumBuffers; ++i)
+		{
+			// acquire, the readers are done with the content before it gets overwritten
+			if (i != current && m_Buffers[i].readers.load(std::memory_order_acquire) == 0)
+			{
+				m_Writing = i;
+				return &m_Buffers[i].Snapshot;
+			}
+		}
+		++m_Skipped;
+		return nullptr;
+	}
+
+	bool SharedSnapshot::publish()
+	{
+		if (m_Writing == NoBuffer)
+			return false;
+		m_Buffers[m_Writing].epoch = ++m_Epoch;
+		const uint64_t previous = m_Current.exchange(static_cast<uint64_t>(m_Writing) << IndexShift, std::memory_order_acq_rel);
+		m_Writing = NoBuffer;
+
+		// the readers that acquired the previous buffer through m_Current now count on the buffer itself
+		const std::size_t previousBuffer = static_cast<std::size_t>(previous >> IndexShift);
+		if (previousBuffer != NoBuffer)
+			m_Buffers[previousBuffer].readers.fetch_add(static_cast<int64_t>(previous & CountMask), std::memory_order_relaxed);
+		return true;
+	}
+
+	SharedSnapshot::Reader SharedSnapshot::acquire() const
+	{
+		// acquire, the content written before the publish is visible
+		const uint64_t current = m_Current.fetch_add(1, std::memory_order_acquire);
+		const std::size_t buffer = static_cast<std::size_t>(current >> IndexShift);
+		// nothing published yet, the count is dropped with the next publish
+		if (buffer == NoBuffer)
+			return Reader();
+		return Reader(this, buffer);
+	}
+}
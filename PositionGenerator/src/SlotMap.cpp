@@ -0,0 +1,52 @@
+#include <stdexcept>
+
+#include "SlotMap.h"
+
+namespace PositionGenerator
+{
+	SlotMap::id_t SlotMap::insert(index_t index)
+	{
+		index_t slot;
+		if (!m_FreeSlots.empty())
+		{
+			slot = m_FreeSlots.back();
+			m_FreeSlots.pop_back();
+		}
+		else
+		{
+			if (m_Slots.size() >= Invalid)
+				throw std::length_error("SlotMap: too many entries");
+			slot = static_cast<index_t>(m_Slots.size());
+			m_Slots.emplace_back();
+		}
+		m_Slots[slot].index = index;
+		++m_Size;
+		return (static_cast<id_t>(m_Slots[slot].generation) << 32) | slot;
+	}
+
+	SlotMap::index_t SlotMap::find(id_t id) const
+	{
+		const index_t slot = slotOf(id);
+		if (slot >= m_Slots.size() || m_Slots[slot].generation != generationOf(id))
+			return Invalid;
+		return m_Slots[slot].index;
+	}
+
+	bool SlotMap::erase(id_t id)
+	{
+		if (!contains(id))
+			return false;
+		Slot& Entry = m_Slots[slotOf(id)];
+		Entry.index = Invalid;
+		++Entry.generation;
+		m_FreeSlots.push_back(slotOf(id));
+		--m_Size;
+		return true;
+	}
+
+	void SlotMap::reserve(std::size_t numEntries)
+	{
+		m_Slots.reserve(numEntries);
+		m_FreeSlots.reserve(numEntries);
+	}
+}
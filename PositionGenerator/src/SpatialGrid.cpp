@@ -0,0 +1,97 @@
+#include <limits>
+#include <stdexcept>
+
+#include "SpatialGrid.h"
+
+namespace PositionGenerator
+{
+	SpatialGrid::SpatialGrid(const Vector3& minValues, const Vector3& maxValues, float cellSize)
+		: m_Min(minValues), m_CellSize(cellSize), m_InvCellSize(1.f / cellSize)
+	{
+		if (!(cellSize > 0.f))
+			throw std::invalid_argument("SpatialGrid: cell size has to be positive");
+
+		const Vector3 extent = maxValues - minValues;
+		const float extents[3] = { extent.x(), extent.y(), extent.z() };
+		uint64_t numCells = 1;
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			const float cells = std::ceil(extents[axis] * m_InvCellSize);
+			m_Dims[axis] = cells > 1.f ? static_cast<uint32_t>(std::min(cells, 1.E9f)) : 1;
+			numCells *= m_Dims[axis];
+			if (numCells >= Invalid)
+				throw std::invalid_argument("SpatialGrid: cell size is too small for the bounding cuboid");
+		}
+		m_Head.assign(static_cast<std::size_t>(numCells), Invalid);
+		m_PackedStart.resize(m_Head.size() + 1);
+	}
+
+	void SpatialGrid::build(std::size_t count, const float* x, const float* y, const float* z)
+	{
+		if (count >= Invalid)
+			throw std::invalid_argument("SpatialGrid: too many positions");
+		m_pX = x;
+		m_pY = y;
+		m_pZ = z;
+
+		std::fill(m_Head.begin(), m_Head.end(), Invalid);
+		m_Next.assign(count, Invalid);
+		m_Prev.assign(count, Invalid);
+		m_Cell.resize(count);
+		m_NewCell.resize(count);
+		m_PackedIndex.resize(count);
+		m_PackedX.resize(count);
+		m_PackedY.resize(count);
+		m_PackedZ.resize(count);
+		computeCells(0, count);
+
+		// linked in reverse, so every list starts in index order
+		for (std::size_t i = count; i-- > 0;)
+			link(static_cast<index_t>(i), m_NewCell[i]);
+	}
+
+	void SpatialGrid::computeCells(std::size_t first, std::size_t last)
+	{
+		for (std::size_t i = first; i < last; ++i)
+			m_NewCell[i] = cellAt(m_pX[i], m_pY[i], m_pZ[i]);
+	}
+
+	std::size_t SpatialGrid::relink()
+	{
+		// the sensors move a fraction of a cell per tick, most of them stay where they are
+		std::size_t moved = 0;
+		const std::size_t count = m_Cell.size();
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			if (m_NewCell[i] == m_Cell[i])
+				continue;
+			unlink(static_cast<index_t>(i));
+			link(static_cast<index_t>(i), m_NewCell[i]);
+			++moved;
+		}
+		return moved;
+	}
+
+	void SpatialGrid::link(index_t index, index_t cell)
+	{
+		const index_t head = m_Head[cell];
+		m_Next[index] = head;
+		m_Prev[index] = Invalid;
+		if (head != Invalid)
+			m_Prev[head] = index;
+		m_Head[cell] = index;
+		m_Cell[index] = cell;
+	}
+
+	void SpatialGrid::unlink(index_t index)
+	{
+		const index_t prev = m_Prev[index];
+		const index_t next = m_Next[index];
+		if (prev != Invalid)
+			m_Next[prev] = next;
+		else
+			m_Head[m_Cell[index]] = next;
+		if (next != Invalid)
+			m_Prev[next] = prev;
+	}
+}
@@ -0,0 +1,109 @@
+#include <array>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include "TickLog.h"
+
+namespace PositionGenerator
+{
+	namespace
+	{
+		// file layout (all uint64, floats and doubles by their bits): magic, seed, initial timestamp, units per second,
+		// number of sensors, random policy, min and max values, max velocity, noise dimension,
+		// number of update rates, update rates, number of ticks, timestamps
+		constexpr char Magic[8] = { 'P', 'G', 'T', 'I', 'C', 'K', 'S', '1' };
+		// more update rates than any configuration uses, guards against allocating for a corrupt count
+		constexpr uint64_t MaxUpdateRates = 1024;
+
+		void writeValue(std::ofstream& Out, uint64_t value)
+		{
+			std::array<char, 8> bytes;
+			for (int i = 0; i < 8; ++i)
+				bytes[i] = static_cast<char>(value >> (8 * i));
+			Out.write(bytes.data(), bytes.size());
+		}
+
+		uint64_t readValue(std::ifstream& In)
+		{
+			std::array<unsigned char, 8> bytes{};
+			In.read(reinterpret_cast<char*>(bytes.data()), bytes.size());
+			uint64_t value = 0;
+			for (int i = 0; i < 8; ++i)
+				value |= static_cast<uint64_t>(bytes[i]) << (8 * i);
+			return value;
+		}
+
+		void writeFloat(std::ofstream& Out, float value) { writeValue(Out, std::bit_cast<uint32_t>(value)); }
+		float readFloat(std::ifstream& In) { return std::bit_cast<float>(static_cast<uint32_t>(readValue(In))); }
+	}
+
+	void TickLog::save(const std::string& fileName) const
+	{
+		std::ofstream Out(fileName, std::ios::binary | std::ios::trunc);
+		if (!Out)
+			throw std::runtime_error("TickLog: can not create " + fileName);
+		Out.write(Magic, sizeof(Magic));
+		writeValue(Out, m_Seed);
+		writeValue(Out, m_InitialTimestamp);
+		writeValue(Out, m_TimestampUnitsPerSecond);
+		writeValue(Out, m_Run.numOfSensors);
+		writeValue(Out, m_Run.randomPolicy);
+		for (float value : m_Run.minValues)
+			writeFloat(Out, value);
+		for (float value : m_Run.maxValues)
+			writeFloat(Out, value);
+		writeFloat(Out, m_Run.maxVelocity);
+		writeFloat(Out, m_Run.noiseDimension);
+		writeValue(Out, m_Run.updateRates.size());
+		for (double rate : m_Run.updateRates)
+			writeValue(Out, std::bit_cast<uint64_t>(rate));
+		writeValue(Out, m_Timestamps.size());
+		for (auto timestamp : m_Timestamps)
+			writeValue(Out, timestamp);
+		if (!Out)
+			throw std::runtime_error("TickLog: error writing " + fileName);
+	}
+
+	TickLog TickLog::load(const std::string& fileName)
+	{
+		std::ifstream In(fileName, std::ios::binary);
+		if (!In)
+			throw std::runtime_error("TickLog: can not open " + fileName);
+		char magic[sizeof(Magic)] = {};
+		In.read(magic, sizeof(magic));
+		if (!In || std::memcmp(magic, Magic, sizeof(Magic)) != 0)
+			throw std::runtime_error("TickLog: " + fileName + " is no tick log");
+
+		TickLog Log;
+		Log.m_Seed = readValue(In);
+		Log.m_InitialTimestamp = readValue(In);
+		Log.m_TimestampUnitsPerSecond = readValue(In);
+		Log.m_Run.numOfSensors = readValue(In);
+		Log.m_Run.randomPolicy = readValue(In);
+		for (float& value : Log.m_Run.minValues)
+			value = readFloat(In);
+		for (float& value : Log.m_Run.maxValues)
+			value = readFloat(In);
+		Log.m_Run.maxVelocity = readFloat(In);
+		Log.m_Run.noiseDimension = readFloat(In);
+		const uint64_t numRates = readValue(In);
+		if (!In || numRates > MaxUpdateRates)
+			throw std::runtime_error("TickLog: corrupt header in " + fileName);
+		for (uint64_t i = 0; i < numRates; ++i)
+			Log.m_Run.updateRates.push_back(std::bit_cast<double>(readValue(In)));
+		const uint64_t numTicks = readValue(In);
+		if (!In)
+			throw std::runtime_error("TickLog: truncated header in " + fileName);
+		// grows with the data read, a corrupt count does not allocate huge amounts up front
+		for (uint64_t i = 0; i < numTicks; ++i)
+		{
+			const uint64_t timestamp = readValue(In);
+			if (!In)
+				throw std::runtime_error("TickLog: truncated tick data in " + fileName);
+			Log.m_Timestamps.push_back(timestamp);
+		}
+		return Log;
+	}
+}
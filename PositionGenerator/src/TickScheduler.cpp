@@ -0,0 +1,63 @@
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+
+#include "TickScheduler.h"
+
+namespace PositionGenerator
+{
+	TickScheduler::TickScheduler(double frequencyInHz, std::chrono::nanoseconds spinWindow)
+		: m_PeriodNs(1.E9 / frequencyInHz), m_SpinWindow(spinWindow)
+	{
+		if (!(frequencyInHz > 0.) || !std::isfinite(frequencyInHz))
+			throw std::invalid_argument("TickScheduler: the frequency has to be positive");
+		restart();
+	}
+
+	void TickScheduler::restart()
+	{
+		m_Start = Clock_t::now();
+		m_NextTick = 0;
+		m_TotalMissed = 0;
+	}
+
+	TickScheduler::Clock_t::time_point TickScheduler::deadline(uint64_t tick) const
+	{
+		// computed from the start each time, rounding errors of the period do not accumulate
+		auto offset = std::chrono::nanoseconds(static_cast<int64_t>(std::llround(static_cast<double>(tick) * m_PeriodNs)));
+		return m_Start + std::chrono::duration_cast<Clock_t::duration>(offset);
+	}
+
+	TickScheduler::TickInfo TickScheduler::waitForNextTick()
+	{
+		TickInfo Info;
+		++m_NextTick;
+		auto Deadline = deadline(m_NextTick);
+		auto now = Clock_t::now();
+
+		if (now >= Deadline)
+		{
+			// overrun - run now and continue with the latest deadline that already passed
+			auto elapsedNs = std::chrono::duration<double, std::nano>(now - m_Start).count();
+			auto latest = static_cast<uint64_t>(elapsedNs / m_PeriodNs);
+			if (latest > m_NextTick)
+			{
+				Info.missedTicks = latest - m_NextTick;
+				m_TotalMissed += Info.missedTicks;
+				m_NextTick = latest;
+			}
+			Info.tick = m_NextTick;
+			return Info;
+		}
+
+		Info.slack = Deadline - now;
+		if (Deadline - now > m_SpinWindow)
+			std::this_thread::sleep_until(Deadline - m_SpinWindow);
+		while (Clock_t::now() < Deadline)
+		{
+			// busy wait for the last part, the os scheduler is not precise enough
+		}
+		Info.tick = m_NextTick;
+		return Info;
+	}
+}
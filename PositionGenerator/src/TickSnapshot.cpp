@@ -0,0 +1,37 @@
+#include <vector>
+
+#include "TickSnapshot.h"
+
+namespace PositionGenerator
+{
+	void splitSnapshot(const TickSnapshot& Snapshot, std::span<TickSnapshot* const> Shards, std::vector<std::size_t>& Counts)
+	{
+		const std::size_t numShards = Shards.size();
+		if (numShards == 0)
+			return;
+
+		// sizes first, so every column is resized once and then filled front to back
+		Counts.assign(numShards, 0);
+		const std::size_t numSensors = Snapshot.size();
+		for (std::size_t i = 0; i < numSensors; ++i)
+			++Counts[shardOf(Snapshot.sensorIds[i], numShards)];
+		for (std::size_t shard = 0; shard < numShards; ++shard)
+		{
+			Shards[shard]->resize(Counts[shard]);
+			Shards[shard]->tickTimestamp = Snapshot.tickTimestamp;
+			Counts[shard] = 0;
+		}
+
+		for (std::size_t i = 0; i < numSensors; ++i)
+		{
+			const std::size_t shard = shardOf(Snapshot.sensorIds[i], numShards);
+			TickSnapshot& Out = *Shards[shard];
+			const std::size_t index = Counts[shard]++;
+			Out.sensorIds[index] = Snapshot.sensorIds[i];
+			Out.timestamps[index] = Snapshot.timestamps[i];
+			Out.x[index] = Snapshot.x[i];
+			Out.y[index] = Snapshot.y[i];
+			Out.z[index] = Snapshot.z[i];
+		}
+	}
+}
@@ -0,0 +1,121 @@
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+#include "TickStats.h"
+
+namespace PositionGenerator
+{
+	namespace
+	{
+		// nanoseconds in a readable unit, e.g. 850ns, 12.3us, 4.1ms
+		void printDuration(std::ostream& Out, uint64_t valueNs)
+		{
+			const double value = static_cast<double>(valueNs);
+			if (valueNs < 1000)
+				Out << valueNs << "ns";
+			else if (valueNs < 1000 * 1000)
+				Out << std::round(value / 100.) / 10. << "us";
+			else if (valueNs < 1000 * 1000 * 1000)
+				Out << std::round(value / 100000.) / 10. << "ms";
+			else
+				Out << std::round(value / 100000000.) / 10. << "s";
+		}
+	}
+
+	uint64_t LatencyDistribution::count() const
+	{
+		uint64_t total = 0;
+		for (auto n : counts)
+			total += n;
+		return total;
+	}
+
+	uint64_t LatencyDistribution::percentile(double q) const
+	{
+		const uint64_t total = count();
+		if (total == 0)
+			return 0;
+		// rank of the value, at least the first one
+		const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(std::clamp(q, 0., 1.) * static_cast<double>(total))));
+		uint64_t seen = 0;
+		for (std::size_t bucket = 0; bucket < counts.size(); ++bucket)
+		{
+			seen += counts[bucket];
+			if (seen >= rank)
+				return LatencyHistogram::bucketUpperBound(bucket);
+		}
+		return LatencyHistogram::bucketUpperBound(counts.size() - 1);
+	}
+
+	std::size_t LatencyHistogram::bucketOf(uint64_t valueNs)
+	{
+		// the first SubBuckets values map one to one, above every power of two is split into SubBuckets
+		if (valueNs < SubBuckets)
+			return static_cast<std::size_t>(valueNs);
+		const unsigned exponent = static_cast<unsigned>(std::bit_width(valueNs)) - 1;
+		if (exponent >= MaxExponent)
+			return NumBuckets - 1;
+		const unsigned shift = exponent - SubBucketBits;
+		const std::size_t subBucket = static_cast<std::size_t>(valueNs >> shift) - SubBuckets;
+		return (shift + 1) * SubBuckets + subBucket;
+	}
+
+	uint64_t LatencyHistogram::bucketUpperBound(std::size_t bucket)
+	{
+		const std::size_t group = bucket / SubBuckets;
+		const uint64_t subBucket = bucket % SubBuckets;
+		if (group == 0)
+			return subBucket;
+		const unsigned shift = static_cast<unsigned>(group - 1);
+		return ((SubBuckets + subBucket + 1) << shift) - 1;
+	}
+
+	void LatencyHistogram::collect(LatencyDistribution& Out)
+	{
+		Out.counts.resize(NumBuckets);
+		for (std::size_t bucket = 0; bucket < NumBuckets; ++bucket)
+			Out.counts[bucket] = m_Counts[bucket].exchange(0, std::memory_order_relaxed);
+	}
+
+	const char* tickStageName(TickStage stage)
+	{
+		switch (stage)
+		{
+		case TickStage::Generate: return "generate";
+		case TickStage::Noise: return "noise";
+		case TickStage::Serialize: return "serialize";
+		case TickStage::Send: return "send";
+		case TickStage::Slack: return "slack";
+		default: return "?";
+		}
+	}
+
+	void TickStats::report(std::ostream& Out)
+	{
+		auto now = Clock_t::now();
+		const double seconds = std::max(std::chrono::duration<double>(now - m_LastReport).count(), 1.E-9);
+		m_LastReport = now;
+
+		Out << " stats:";
+		for (std::size_t stage = 0; stage < m_Stages.size(); ++stage)
+		{
+			m_Stages[stage].collect(m_Distribution);
+			if (m_Distribution.count() == 0)
+				continue;
+			Out << " " << tickStageName(static_cast<TickStage>(stage)) << " p50 ";
+			printDuration(Out, m_Distribution.percentile(0.5));
+			Out << " p99 ";
+			printDuration(Out, m_Distribution.percentile(0.99));
+			Out << " p999 ";
+			printDuration(Out, m_Distribution.percentile(0.999));
+			Out << " |";
+		}
+		const double ticks = static_cast<double>(m_Ticks.exchange(0, std::memory_order_relaxed));
+		const double messages = static_cast<double>(m_Messages.exchange(0, std::memory_order_relaxed));
+		const double bytes = static_cast<double>(m_Bytes.exchange(0, std::memory_order_relaxed));
+		Out << " " << std::round(ticks / seconds * 10.) / 10. << " ticks/s "
+			<< static_cast<uint64_t>(std::llround(messages / seconds)) << " msg/s "
+			<< std::round(bytes / seconds / (1024. * 1024.) * 10.) / 10. << " MiB/s\n";
+	}
+}
@@ -0,0 +1,76 @@
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+#include "UpdateWheel.h"
+
+namespace PositionGenerator
+{
+	UpdateWheel::UpdateWheel(timestamp_t start, timestamp_t slotWidth, std::size_t numSlots)
+		: m_SlotShift(slotWidth > 0 ? static_cast<unsigned>(std::bit_width(slotWidth)) - 1 : 0), m_Cursor(start >> m_SlotShift)
+	{
+		if (slotWidth == 0)
+			throw std::invalid_argument("UpdateWheel: slot width has to be positive");
+		if (numSlots == 0 || numSlots >= Invalid)
+			throw std::invalid_argument("UpdateWheel: invalid number of slots");
+		m_Slots.resize(std::bit_ceil(numSlots));
+	}
+
+	void UpdateWheel::resize(std::size_t count)
+	{
+		if (count >= Invalid)
+			throw std::invalid_argument("UpdateWheel: too many entries");
+		if (count < m_Due.size())
+		{
+			for (auto& Entries : m_Slots)
+				std::erase_if(Entries, [count](index_t index) { return index >= count; });
+		}
+		m_Slot.resize(count, Invalid);
+		m_Due.resize(count, 0);
+	}
+
+	void UpdateWheel::schedule(index_t index, timestamp_t due)
+	{
+		// overdue entries go into the cursor slot, so the next popDue finds them
+		const index_t slot = static_cast<index_t>(std::max(due >> m_SlotShift, m_Cursor) & (m_Slots.size() - 1));
+		if (m_Slot[index] != slot)
+		{
+			m_Slots[slot].push_back(index);
+			m_Slot[index] = slot;
+		}
+		m_Due[index] = due;
+	}
+
+	std::size_t UpdateWheel::popDue(timestamp_t now, std::vector<index_t>& Due)
+	{
+		const std::size_t before = Due.size();
+		const uint64_t target = now >> m_SlotShift;
+		if (target < m_Cursor)
+			return 0;
+		// after a full turn every slot has been looked at once
+		const uint64_t numSteps = std::min<uint64_t>(target - m_Cursor + 1, m_Slots.size());
+		for (uint64_t step = 0; step < numSteps; ++step)
+		{
+			const index_t slot = static_cast<index_t>((m_Cursor + step) & (m_Slots.size() - 1));
+			auto& Entries = m_Slots[slot];
+			std::size_t kept = 0;
+			for (const index_t index : Entries)
+			{
+				// cancelled or moved to another slot
+				if (m_Slot[index] != slot)
+					continue;
+				if (m_Due[index] <= now)
+				{
+					m_Slot[index] = Invalid;
+					Due.push_back(index);
+				}
+				else
+					Entries[kept++] = index;
+			}
+			Entries.resize(kept);
+		}
+		// the slot of now stays the cursor, it may still hold entries due later in the slot
+		m_Cursor = target;
+		return Due.size() - before;
+	}
+}
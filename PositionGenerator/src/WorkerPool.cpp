@@ -0,0 +1,137 @@
+#include <algorithm>
+
+#include "WorkerPool.h"
+
+namespace PositionGenerator
+{
+	WorkerPool::WorkerPool(unsigned numThreads)
+	{
+		if (numThreads == 0)
+			numThreads = std::max(1u, std::thread::hardware_concurrency());
+
+		for (unsigned i = 0; i < numThreads; ++i)
+			m_Queues.emplace_back(std::make_unique<WorkQueue>());
+
+		// participant 0 is the thread calling run()
+		for (unsigned i = 1; i < numThreads; ++i)
+			m_Threads.emplace_back(&WorkerPool::workerLoop, this, i);
+	}
+
+	WorkerPool::~WorkerPool()
+	{
+		{
+			std::lock_guard<std::mutex> Lock(m_Mutex);
+			m_Stop = true;
+		}
+		m_WakeUp.notify_all();
+		for (auto& Thread : m_Threads)
+			Thread.join();
+	}
+
+	void WorkerPool::run(std::size_t numShards, const Task_t& Task)
+	{
+		if (numShards == 0)
+			return;
+
+		// task and counter have to be visible before the first shard can be taken from a queue
+		m_pTask = &Task;
+		m_Error = nullptr;
+		m_Remaining = numShards;
+
+		// hand out contiguous blocks, neighbouring shards stay on the same thread unless stolen
+		const std::size_t numQueues = m_Queues.size();
+		for (std::size_t q = 0; q < numQueues; ++q)
+		{
+			const std::size_t first = numShards * q / numQueues;
+			const std::size_t last = numShards * (q + 1) / numQueues;
+			std::lock_guard<std::mutex> Lock(m_Queues[q]->Mutex);
+			for (std::size_t shard = first; shard < last; ++shard)
+				m_Queues[q]->Shards.push_back(shard);
+		}
+
+		{
+			std::lock_guard<std::mutex> Lock(m_Mutex);
+			++m_Generation;
+		}
+		m_WakeUp.notify_all();
+
+		processShards(0);
+
+		std::unique_lock<std::mutex> Lock(m_Mutex);
+		m_Done.wait(Lock, [this]() { return m_Remaining == 0; });
+		m_pTask = nullptr;
+		if (m_Error)
+			std::rethrow_exception(m_Error);
+	}
+
+	void WorkerPool::workerLoop(std::size_t participant)
+	{
+		uint64_t seenGeneration = 0;
+		while (true)
+		{
+			{
+				std::unique_lock<std::mutex> Lock(m_Mutex);
+				m_WakeUp.wait(Lock, [&]() { return m_Stop || m_Generation != seenGeneration; });
+				if (m_Stop)
+					return;
+				seenGeneration = m_Generation;
+			}
+			processShards(participant);
+		}
+	}
+
+	void WorkerPool::processShards(std::size_t participant)
+	{
+		std::size_t shard = 0;
+		while (popShard(participant, shard))
+		{
+			try
+			{
+				(*m_pTask)(shard);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> Lock(m_Mutex);
+				if (!m_Error)
+					m_Error = std::current_exception();
+			}
+
+			if (--m_Remaining == 0)
+			{
+				// lock so the notification can not get lost between the predicate check and the wait in run()
+				std::lock_guard<std::mutex> Lock(m_Mutex);
+				m_Done.notify_all();
+			}
+		}
+	}
+
+	bool WorkerPool::popShard(std::size_t participant, std::size_t& shard)
+	{
+		// own queue first, from the front
+		{
+			WorkQueue& Own = *m_Queues[participant];
+			std::lock_guard<std::mutex> Lock(Own.Mutex);
+			if (!Own.Shards.empty())
+			{
+				shard = Own.Shards.front();
+				Own.Shards.pop_front();
+				return true;
+			}
+		}
+
+		// steal from the back of the others, starting with the next participant
+		const std::size_t numQueues = m_Queues.size();
+		for (std::size_t offset = 1; offset < numQueues; ++offset)
+		{
+			WorkQueue& Victim = *m_Queues[(participant + offset) % numQueues];
+			std::lock_guard<std::mutex> Lock(Victim.Mutex);
+			if (!Victim.Shards.empty())
+			{
+				shard = Victim.Shards.back();
+				Victim.Shards.pop_back();
+				return true;
+			}
+		}
+		return false;
+	}
+}
@@ -0,0 +1,113 @@
+#include <chrono>
+
+#include "PublishPipeline.h"
+
+namespace PositionGenerator
+{
+  namespace
+  {
+    // short spin for the common case of a stage that is just about to finish, then give the core away
+    void backoff(unsigned& round)
+    {
+      if (++round < 64)
+        return;
+      if (round < 128)
+        std::this_thread::yield();
+      else
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+  }
+
+  PublishPipeline::PublishPipeline(MessageBuilder& Builder, SendFunction_t Send, std::size_t depth, TickStats* pStats)
+    : m_Builder(Builder), m_Send(std::move(Send)), m_pStats(pStats)
+    , m_Snapshots(depth), m_Frames(depth)
+    , m_FreeSnapshots(depth), m_ReadySnapshots(depth), m_FreeFrames(depth), m_ReadyFrames(depth)
+  {
+    for (auto& Snapshot : m_Snapshots)
+      m_FreeSnapshots.tryPush(&Snapshot);
+    for (auto& Frames : m_Frames)
+      m_FreeFrames.tryPush(&Frames);
+
+    m_Serializer = std::thread(&PublishPipeline::serializeLoop, this);
+    m_Sender = std::thread(&PublishPipeline::sendLoop, this);
+  }
+
+  PublishPipeline::~PublishPipeline()
+  {
+    stop();
+  }
+
+  TickSnapshot* PublishPipeline::acquireSnapshot()
+  {
+    TickSnapshot* pSnapshot = nullptr;
+    unsigned round = 0;
+    while (!m_FreeSnapshots.tryPop(pSnapshot))
+      backoff(round);
+    return pSnapshot;
+  }
+
+  void PublishPipeline::submit(TickSnapshot* pSnapshot)
+  {
+    // can not fail, there are never more snapshots than slots
+    m_ReadySnapshots.tryPush(pSnapshot);
+  }
+
+  void PublishPipeline::stop()
+  {
+    m_Stop = true;
+    if (m_Serializer.joinable())
+      m_Serializer.join();
+    if (m_Sender.joinable())
+      m_Sender.join();
+  }
+
+  void PublishPipeline::serializeLoop()
+  {
+    unsigned round = 0;
+    TickSnapshot* pSnapshot = nullptr;
+    while (true)
+    {
+      if (!m_ReadySnapshots.tryPop(pSnapshot))
+      {
+        if (m_Stop && m_ReadySnapshots.empty())
+          break;
+        backoff(round);
+        continue;
+      }
+      round = 0;
+
+      TickFrames* pFrames = nullptr;
+      while (!m_FreeFrames.tryPop(pFrames))
+        backoff(round);
+      round = 0;
+
+      {
+        StageTimer Timer(m_pStats, TickStage::Serialize);
+        m_Builder.buildTick(*pSnapshot, *pFrames);
+      }
+      m_FreeSnapshots.tryPush(pSnapshot);
+      m_ReadyFrames.tryPush(pFrames);
+    }
+    m_SerializerDone = true;
+  }
+
+  void PublishPipeline::sendLoop()
+  {
+    unsigned round = 0;
+    TickFrames* pFrames = nullptr;
+    while (true)
+    {
+      if (!m_ReadyFrames.tryPop(pFrames))
+      {
+        if (m_SerializerDone && m_ReadyFrames.empty())
+          break;
+        backoff(round);
+        continue;
+      }
+      round = 0;
+
+      m_Send(*pFrames);
+      m_FreeFrames.tryPush(pFrames);
+    }
+  }
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "MessageBuilder.h"
+#include "SpscRing.h"
+#include "TickSnapshot.h"
+#include "TickStats.h"
+
+namespace PositionGenerator
+{
+  // three stage publish pipeline: the calling thread generates, a serializer thread builds the frames
+  // and a sender thread transmits them. The stages hand pooled snapshots and frame lists to each other
+  // through lock-free SPSC rings, so generation of tick N+1 overlaps serialization of tick N and
+  // transmission of tick N-1.
+  class PublishPipeline
+  {
+  public:
+    using SendFunction_t = std::function<void(TickFrames& Frames)>;
+
+    // depth is the number of ticks that can be in flight per stage
+    // with pStats the serializer records the time of every buildTick
+    PublishPipeline(MessageBuilder& Builder, SendFunction_t Send, std::size_t depth = 4, TickStats* pStats = nullptr);
+    ~PublishPipeline();
+    PublishPipeline(const PublishPipeline&) = delete;
+    PublishPipeline& operator=(const PublishPipeline&) = delete;
+
+    // generating thread: waits for a free snapshot, fill it and hand it back with submit()
+    // waiting here means the later stages fell behind
+    TickSnapshot* acquireSnapshot();
+    void submit(TickSnapshot* pSnapshot);
+
+    // finishes all submitted ticks and stops the threads
+    void stop();
+
+  private:
+    MessageBuilder& m_Builder;
+    SendFunction_t m_Send;
+    TickStats* m_pStats;
+
+    std::vector<TickSnapshot> m_Snapshots;
+    std::vector<TickFrames> m_Frames;
+    SpscRing<TickSnapshot*> m_FreeSnapshots;   // serializer -> generator
+    SpscRing<TickSnapshot*> m_ReadySnapshots;  // generator -> serializer
+    SpscRing<TickFrames*> m_FreeFrames;        // sender -> serializer
+    SpscRing<TickFrames*> m_ReadyFrames;       // serializer -> sender
+
+    std::atomic_bool m_Stop = false;
+    std::atomic_bool m_SerializerDone = false;
+    std::thread m_Serializer;
+    std::thread m_Sender;
+
+    void serializeLoop();
+    void sendLoop();
+  };
+}
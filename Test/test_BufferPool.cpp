@@ -0,0 +1,75 @@
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "BufferPool.h"
+
+TEST(BufferPool, reuseWithoutAllocation)
+{
+	using namespace PositionGenerator;
+	BufferPool Pool(2, 1024);
+	EXPECT_EQ(Pool.numFree(), 2);
+
+	for (int round = 0; round < 100; ++round)
+	{
+		auto* pFirst = Pool.acquire(1000);
+		auto* pSecond = Pool.acquire(1024);
+		EXPECT_NE(pFirst, pSecond);
+		EXPECT_GE(pFirst->capacity(), 1000);
+		EXPECT_EQ(Pool.numFree(), 0);
+		pFirst->release();
+		pSecond->release();
+	}
+	EXPECT_EQ(Pool.numAllocations(), 0);
+	EXPECT_EQ(Pool.numFree(), 2);
+
+	// exhausted pool and too small buffers grow once
+	auto* p1 = Pool.acquire(2048);
+	auto* p2 = Pool.acquire(16);
+	auto* p3 = Pool.acquire(16);
+	EXPECT_GT(Pool.numAllocations(), 0);
+	p1->release();
+	p2->release();
+	p3->release();
+	EXPECT_EQ(Pool.numFree(), 3);
+}
+
+TEST(BufferPool, releasedByLastReference)
+{
+	using namespace PositionGenerator;
+	BufferPool Pool(1, 64);
+	auto* pBuffer = Pool.acquire(64);
+
+	// hand out references to other threads, the buffer returns with the last release
+	constexpr int numRefs = 8;
+	for (int i = 0; i < numRefs; ++i)
+		pBuffer->addRef();
+	pBuffer->release();
+	EXPECT_EQ(Pool.numFree(), 0);
+
+	std::vector<std::thread> Threads;
+	for (int i = 0; i < numRefs; ++i)
+		Threads.emplace_back([pBuffer]() { pBuffer->release(); });
+	for (auto& Thread : Threads)
+		Thread.join();
+	EXPECT_EQ(Pool.numFree(), 1);
+}
+
+TEST(BufferPool, hugePages)
+{
+	using namespace PositionGenerator;
+	BufferPool Pool(2, HugePageSize, MemoryPolicy::HugePages);
+	auto* pBuffer = Pool.acquire(HugePageSize);
+	EXPECT_EQ(reinterpret_cast<uintptr_t>(pBuffer->data()) % HugePageSize, 0u);
+	pBuffer->data()[HugePageSize - 1] = 5;
+	// growing replaces the storage, small buffers come from the heap
+	pBuffer->release();
+	auto* pLarger = Pool.acquire(2 * HugePageSize + 1);
+	EXPECT_GE(pLarger->capacity(), 2 * HugePageSize + 1);
+	pLarger->data()[2 * HugePageSize] = 6;
+	pLarger->release();
+	BufferPool Small(1, 256, MemoryPolicy::HugePages);
+	Small.acquire(256)->release();
+}
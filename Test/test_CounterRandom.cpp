@@ -0,0 +1,59 @@
+#include <set>
+
+#include "gtest/gtest.h"
+
+#include "CounterRandom.h"
+
+TEST(Philox4x32, knownAnswer)
+{
+	using namespace PositionGenerator;
+	// test vectors of the Random123 reference implementation
+	auto r0 = Philox4x32::generate({ 0, 0, 0, 0 }, { 0, 0 });
+	EXPECT_EQ(r0, (Philox4x32::Counter_t{ 0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u }));
+
+	auto r1 = Philox4x32::generate({ 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu }, { 0xffffffffu, 0xffffffffu });
+	EXPECT_EQ(r1, (Philox4x32::Counter_t{ 0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu }));
+
+	auto r2 = Philox4x32::generate({ 0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u }, { 0xa4093822u, 0x299f31d0u });
+	EXPECT_EQ(r2, (Philox4x32::Counter_t{ 0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u }));
+}
+
+TEST(CounterRandom, orderIndependence)
+{
+	using namespace PositionGenerator;
+	CounterRandom Rnd(4711);
+
+	// same key and counter always give the same numbers, independent of what was drawn before
+	auto first = Rnd.uniform(RandomStream::Motion, 17, 1000);
+	for (uint64_t id = 0; id < 100; ++id)
+		Rnd.uniform(RandomStream::Motion, id, 2000);
+	EXPECT_EQ(first, Rnd.uniform(RandomStream::Motion, 17, 1000));
+	EXPECT_EQ(first, CounterRandom(4711).uniform(RandomStream::Motion, 17, 1000));
+
+	// different seed, stream, sensor or tick give different numbers
+	EXPECT_NE(first, CounterRandom(4712).uniform(RandomStream::Motion, 17, 1000));
+	EXPECT_NE(first, Rnd.uniform(RandomStream::Noise, 17, 1000));
+	EXPECT_NE(first, Rnd.uniform(RandomStream::Motion, 18, 1000));
+	EXPECT_NE(first, Rnd.uniform(RandomStream::Motion, 17, 1001));
+}
+
+TEST(CounterRandom, uniformRange)
+{
+	using namespace PositionGenerator;
+	EXPECT_EQ(CounterRandom::toUnitFloat(0), 0.f);
+	EXPECT_LT(CounterRandom::toUnitFloat(0xffffffffu), 1.f);
+
+	CounterRandom Rnd(1);
+	constexpr int numDraws = 10000;
+	double sum = 0.;
+	for (int i = 0; i < numDraws; ++i)
+	{
+		for (float v : Rnd.uniform(RandomStream::Motion, i, 0))
+		{
+			EXPECT_GE(v, 0.f);
+			EXPECT_LT(v, 1.f);
+			sum += v;
+		}
+	}
+	EXPECT_NEAR(sum / (4. * numDraws), 0.5, 0.01);
+}
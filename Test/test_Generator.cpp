@@ -1,4 +1,13 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <random>
 #include <set>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -207,5 +216,571 @@ TEST(Generator, noiseGen)
 	EXPECT_LE(DistSum / static_cast<float>(NumRounds), 0.8f * noiseDist);
 }
 
+TEST(Generator, counterBasedPolicy)
+{
+	using namespace PositionGenerator;
+
+	float maxVelocity = 10.0; // 10m/s
+	uint64_t timeStampUnitsPerSecond = 1000000; // usec
+	timestamp_t initialTime = 0;
+	Vector3 minValues(10.f, 10.f, 0.2f);
+	Vector3 maxValues(110.f, 110.f, 1.5f);
+	int numSensors = 120;
+	float noiseDist = 0.3f;
+
+	Generator Gen(GenerationParameter()
+		.setMaximalVelocity(maxVelocity)
+		.setNumOfSensors(numSensors)
+		.setInitialTimestamp(initialTime)
+		.setBoundingCuboid(minValues, maxValues)
+		.setTimestampUnitPerSecond(timeStampUnitsPerSecond)
+		.setNoiseDimension(noiseDist)
+		.setRandomPolicy(RandomPolicy::CounterBased)
+	);
+
+	auto testTime = initialTime;
+	for (int round = 0; round < 20; ++round)
+	{
+		testTime += timeStampUnitsPerSecond / 10;
+		Gen.generateData(testTime);
+		for (const auto& Sensor : Gen)
+		{
+			auto Pos = Sensor.position();
+			EXPECT_GE(Pos.x(), minValues.x());
+			EXPECT_GE(Pos.y(), minValues.y());
+			EXPECT_LE(Pos.x(), maxValues.x());
+			EXPECT_LE(Pos.y(), maxValues.y());
+
+			// noise of a sensor only depends on sensor and timestamp
+			auto Noisy = Gen.addNoise(Sensor);
+			auto Again = Gen.addNoise(Sensor);
+			EXPECT_EQ(Noisy.x(), Again.x());
+			EXPECT_EQ(Noisy.y(), Again.y());
+			EXPECT_LE(sqrtf(scalarProduct(Noisy - Pos, Noisy - Pos)), noiseDist);
+		}
+	}
+}
+
+TEST(Generator, multiThreaded)
+{
+	using namespace PositionGenerator;
+
+	float maxVelocity = 10.0; // 10m/s
+	uint64_t timeStampUnitsPerSecond = 1000000; // usec
+	Vector3 minValues(10.f, 10.f, 0.2f);
+	Vector3 maxValues(110.f, 110.f, 1.5f);
+	int numSensors = 10000;
+
+	for (auto policy : { RandomPolicy::MersenneTwister, RandomPolicy::CounterBased })
+	{
+		Generator Gen(GenerationParameter()
+			.setMaximalVelocity(maxVelocity)
+			.setNumOfSensors(numSensors)
+			.setBoundingCuboid(minValues, maxValues)
+			.setTimestampUnitPerSecond(timeStampUnitsPerSecond)
+			.setRandomPolicy(policy)
+			.setNumOfThreads(4)
+			.setShardSize(256)
+		);
+
+		std::vector<SensorPosition> Old(Gen.begin(), Gen.end());
+		timestamp_t testTime = timeStampUnitsPerSecond;
+		Gen.generateData(testTime);
+
+		ASSERT_EQ(Old.size(), Gen.sensors().size());
+		for (std::size_t i = 0; i < Old.size(); ++i)
+		{
+			auto Sensor = Gen.sensors().at(i);
+			Vector3 move = Sensor.position() - Old[i].position();
+			EXPECT_EQ(Sensor.sensorId(), Old[i].sensorId());
+			EXPECT_EQ(Sensor.timestamp(), testTime);
+			EXPECT_LE(sqrtf(scalarProduct(move, move)), maxVelocity);
+			EXPECT_GT(sqrtf(scalarProduct(move, move)), 0.f);
+		}
+	}
+}
+
+TEST(Generator, captureSnapshot)
+{
+	using namespace PositionGenerator;
+
+	Vector3 minValues(10.f, 10.f, 0.2f);
+	Vector3 maxValues(110.f, 110.f, 1.5f);
+	float noiseDist = 0.5f;
+	Generator Gen(GenerationParameter()
+		.setNumOfSensors(100)
+		.setBoundingCuboid(minValues, maxValues)
+		.setNoiseDimension(noiseDist)
+		.setRandomPolicy(RandomPolicy::CounterBased)
+	);
+
+	timestamp_t testTime = 500000;
+	Gen.generateData(testTime);
+	TickSnapshot Snapshot;
+	Gen.captureSnapshot(Snapshot);
+
+	EXPECT_EQ(Snapshot.tickTimestamp, testTime);
+	ASSERT_EQ(Snapshot.size(), Gen.sensors().size());
+	for (std::size_t i = 0; i < Snapshot.size(); ++i)
+	{
+		auto Sensor = Gen.sensors().at(i);
+		Vector3 Noisy(Snapshot.x[i], Snapshot.y[i], Snapshot.z[i]);
+		EXPECT_EQ(Snapshot.sensorIds[i], Sensor.sensorId());
+		EXPECT_EQ(Snapshot.timestamps[i], testTime);
+		EXPECT_LE(sqrtf(scalarProduct(Noisy - Sensor.position(), Noisy - Sensor.position())), noiseDist * 1.001f);
+		// the batched noise of the snapshot equals the per sensor noise
+		auto Single = Gen.addNoise(Sensor);
+		EXPECT_EQ(Snapshot.x[i], Single.x());
+		EXPECT_EQ(Snapshot.y[i], Single.y());
+	}
+}
+
+TEST(Generator, batchNoise)
+{
+	using namespace PositionGenerator;
 
+	float noiseDist = 0.3f;
+	for (auto policy : { RandomPolicy::MersenneTwister, RandomPolicy::CounterBased })
+	{
+		Generator Gen(GenerationParameter()
+			.setNoiseDimension(noiseDist)
+			.setRandomPolicy(policy)
+		);
+
+		// not a multiple of the internal chunk size
+		std::vector<Vector3> Positions;
+		for (int i = 0; i < 1000; ++i)
+			Positions.emplace_back(i * 0.1f, 50.f - i * 0.05f, 1.f + i * 0.001f);
+		std::vector<Vector3> Noisy(Positions.size());
+		Gen.addNoise(Positions, Noisy);
+
+		std::size_t numMoved = 0;
+		for (std::size_t i = 0; i < Positions.size(); ++i)
+		{
+			Vector3 diff = Noisy[i] - Positions[i];
+			EXPECT_LE(sqrtf(scalarProduct(diff, diff)), noiseDist * 1.001f);
+			EXPECT_EQ(Noisy[i].z(), Positions[i].z());
+			if (diff.x() != 0.f || diff.y() != 0.f)
+				++numMoved;
+		}
+		EXPECT_GT(numMoved, Positions.size() / 2);
+
+		// in place
+		std::vector<Vector3> InPlace = Positions;
+		Gen.addNoise(InPlace, InPlace);
+		for (std::size_t i = 0; i < Positions.size(); ++i)
+		{
+			Vector3 diff = InPlace[i] - Positions[i];
+			EXPECT_LE(sqrtf(scalarProduct(diff, diff)), noiseDist * 1.001f);
+		}
+
+		std::vector<Vector3> TooShort(Positions.size() - 1);
+		EXPECT_THROW(Gen.addNoise(Positions, TooShort), std::invalid_argument);
+	}
+}
+
+TEST(Generator, seededIsDeterministic)
+{
+	using namespace PositionGenerator;
+
+	for (auto policy : { RandomPolicy::MersenneTwister, RandomPolicy::CounterBased })
+	{
+		auto Param = GenerationParameter()
+			.setNumOfSensors(2000)
+			.setRandomPolicy(policy)
+			.setSeed(4711);
+		Generator First(Param);
+		Generator Second(GenerationParameter(Param).setNumOfThreads(3).setShardSize(128));
+		EXPECT_EQ(First.seed(), 4711u);
+		EXPECT_EQ(Second.seed(), 4711u);
+
+		TickSnapshot FirstSnapshot, SecondSnapshot;
+		for (timestamp_t t = 1; t <= 10; ++t)
+		{
+			First.generateData(t * 100000);
+			Second.generateData(t * 100000);
+			First.captureSnapshot(FirstSnapshot);
+			Second.captureSnapshot(SecondSnapshot);
+		}
+		ASSERT_EQ(FirstSnapshot.size(), SecondSnapshot.size());
+		for (std::size_t i = 0; i < FirstSnapshot.size(); ++i)
+		{
+			EXPECT_EQ(FirstSnapshot.x[i], SecondSnapshot.x[i]);
+			EXPECT_EQ(FirstSnapshot.y[i], SecondSnapshot.y[i]);
+			EXPECT_EQ(FirstSnapshot.z[i], SecondSnapshot.z[i]);
+		}
+
+		// a different seed gives a different run
+		Generator Same(Param);
+		Generator Other(GenerationParameter(Param).setSeed(4712));
+		EXPECT_NE(Other.sensors().at(0).position().x(), Same.sensors().at(0).position().x());
+	}
+}
 
+TEST(Generator, proximityEvents)
+{
+	using namespace PositionGenerator;
+	constexpr float radius = 1.5f;
+	auto Param = GenerationParameter()
+		.setNumOfSensors(3000)
+		.setRandomPolicy(RandomPolicy::CounterBased)
+		.setProximityRadius(radius)
+		.setSeed(11);
+	Generator Gen(Param);
+	Generator Threaded(GenerationParameter(Param).setNumOfThreads(3).setShardSize(256));
+	ASSERT_NE(Gen.grid(), nullptr);
+	EXPECT_EQ(Gen.grid()->cellSize(), radius);
+	EXPECT_EQ(Generator(GenerationParameter()).grid(), nullptr);
+
+	for (timestamp_t t = 1; t <= 5; ++t)
+	{
+		Gen.generateData(t * 200000);
+		Threaded.generateData(t * 200000);
+	}
+
+	std::set<std::pair<sensorId_t, sensorId_t>> Expected;
+	const auto& Sensors = Gen.sensors();
+	for (std::size_t i = 0; i < Sensors.size(); ++i)
+		for (std::size_t j = i + 1; j < Sensors.size(); ++j)
+		{
+			auto Diff = Sensors.at(i).position() - Sensors.at(j).position();
+			if (Diff.x() * Diff.x() + Diff.y() * Diff.y() + Diff.z() * Diff.z() <= radius * radius)
+				Expected.insert(std::minmax(Sensors.at(i).sensorId(), Sensors.at(j).sensorId()));
+		}
+	ASSERT_FALSE(Expected.empty());
+
+	std::set<std::pair<sensorId_t, sensorId_t>> Found;
+	for (const auto& Event : Gen.proximityEvents())
+	{
+		EXPECT_LT(Event.first, Event.second);
+		EXPECT_LE(Event.distance, radius);
+		Found.insert({ Event.first, Event.second });
+	}
+	EXPECT_EQ(Found.size(), Gen.proximityEvents().size());
+	EXPECT_EQ(Found, Expected);
+
+	// the grid is updated in the shards as well
+	ASSERT_EQ(Threaded.proximityEvents().size(), Gen.proximityEvents().size());
+	for (std::size_t i = 0; i < Gen.proximityEvents().size(); ++i)
+	{
+		EXPECT_EQ(Threaded.proximityEvents()[i].first, Gen.proximityEvents()[i].first);
+		EXPECT_EQ(Threaded.proximityEvents()[i].second, Gen.proximityEvents()[i].second);
+	}
+
+	// range query around a sensor finds at least the sensor itself
+	bool foundSelf = false;
+	Gen.grid()->forEachInRange(Sensors.at(42).position(), 0.5f, [&](uint32_t index, float) { foundSelf |= index == 42; });
+	EXPECT_TRUE(foundSelf);
+}
+
+TEST(Generator, updateRates)
+{
+	using namespace PositionGenerator;
+	constexpr int numSensors = 100;
+	constexpr timestamp_t tick = 5000;
+	Generator Gen(GenerationParameter()
+		.setNumOfSensors(numSensors)
+		.setRandomPolicy(RandomPolicy::CounterBased)
+		.setUpdateRates({ 10., 200. })
+		.setSeed(3));
+	ASSERT_TRUE(Gen.hasUpdateRates());
+	EXPECT_EQ(Gen.updatePeriod(0), 100000u);
+	EXPECT_EQ(Gen.updatePeriod(numSensors - 1), 5000u);
+
+	std::vector<int> Updates(numSensors);
+	TickSnapshot Snapshot;
+	for (timestamp_t t = tick; t <= 1000000; t += tick)
+	{
+		Gen.generateData(t);
+		Gen.captureUpdates(Snapshot);
+		ASSERT_EQ(Snapshot.size(), Gen.updatedSensors().size());
+		for (std::size_t i = 0; i < Snapshot.size(); ++i)
+		{
+			const auto index = Gen.updatedSensors()[i];
+			++Updates[index];
+			EXPECT_EQ(Snapshot.sensorIds[i], Gen.sensors().at(index).sensorId());
+			EXPECT_EQ(Snapshot.timestamps[i], t);
+		}
+	}
+	// the sensors not due keep their last timestamp
+	for (int i = 0; i < numSensors; ++i)
+	{
+		EXPECT_EQ(Updates[i], i < numSensors / 2 ? 10 : 200) << "sensor " << i;
+		EXPECT_GT(Gen.sensors().at(i).timestamp(), 1000000u - Gen.updatePeriod(i));
+	}
+
+	EXPECT_FALSE(Generator(GenerationParameter()).hasUpdateRates());
+	EXPECT_THROW(Generator(GenerationParameter().setUpdateRates({ 10., 0. })), std::invalid_argument);
+}
+
+TEST(Generator, updateRatesMatchFullUpdate)
+{
+	using namespace PositionGenerator;
+	// a period of one timestamp unit is due on every tick, with the counter based policy
+	// the gathered update has to give the same results as the update of all sensors
+	auto Param = GenerationParameter()
+		.setNumOfSensors(1000)
+		.setRandomPolicy(RandomPolicy::CounterBased)
+		.setSeed(8);
+	Generator Full(Param);
+	Generator Gathered(GenerationParameter(Param).setUpdateRates({ 1000000. }));
+	Generator Threaded(GenerationParameter(Param).setUpdateRates({ 1000000. }).setNumOfThreads(3).setShardSize(64));
+	for (timestamp_t t = 40000; t <= 400000; t += 40000)
+	{
+		Full.generateData(t);
+		Gathered.generateData(t);
+		Threaded.generateData(t);
+		ASSERT_EQ(Gathered.updatedSensors().size(), Full.sensors().size());
+	}
+	for (std::size_t i = 0; i < Full.sensors().size(); ++i)
+	{
+		auto Expected = Full.sensors().at(i).position();
+		for (const Generator* pGen : { &Gathered, &Threaded })
+		{
+			auto Pos = pGen->sensors().at(i).position();
+			EXPECT_EQ(Pos.x(), Expected.x());
+			EXPECT_EQ(Pos.y(), Expected.y());
+			EXPECT_EQ(Pos.z(), Expected.z());
+		}
+		EXPECT_EQ(Gathered.sensors().at(i).timestamp(), 400000u);
+	}
+}
+
+TEST(Generator, estimatePositions)
+{
+	using namespace PositionGenerator;
+	auto Param = GenerationParameter()
+		.setNumOfSensors(500)
+		.setSeed(21);
+	Generator Gen(Param);
+	Generator Untouched(Param);
+	Gen.generateData(100000);
+	Untouched.generateData(100000);
+	std::vector<SensorPosition> Previous(Gen.begin(), Gen.end());
+	Gen.generateData(200000);
+	Untouched.generateData(200000);
+	std::vector<SensorPosition> Current(Gen.begin(), Gen.end());
+
+	TickSnapshot Estimate;
+	Estimate.resize(Current.size());
+	for (timestamp_t t : { 100000u, 150000u, 200000u, 300000u })
+	{
+		Gen.estimatePositions(0, Current.size(), t, Estimate.columns());
+		for (std::size_t i = 0; i < Current.size(); ++i)
+		{
+			EXPECT_EQ(Estimate.sensorIds[i], Current[i].sensorId());
+			EXPECT_EQ(Estimate.timestamps[i], t);
+			auto Pos = Gen.estimatePosition(i, t);
+			EXPECT_EQ(Estimate.x[i], Pos.x());
+			EXPECT_EQ(Estimate.y[i], Pos.y());
+			EXPECT_EQ(Estimate.z[i], Pos.z());
+			EXPECT_GE(Pos.x(), Param.minValues().x());
+			EXPECT_LE(Pos.x(), Param.maxValues().x());
+			EXPECT_GE(Pos.z(), Param.minValues().z());
+			EXPECT_LE(Pos.z(), Param.maxValues().z());
+		}
+	}
+
+	// the last update gives the current, the one before the previous position, halfway is in between
+	for (std::size_t i = 0; i < Current.size(); ++i)
+	{
+		auto Now = Gen.estimatePosition(i, 200000);
+		EXPECT_EQ(Now.x(), Current[i].position().x());
+		EXPECT_EQ(Now.y(), Current[i].position().y());
+		auto Before = Gen.estimatePosition(i, 100000) - Previous[i].position();
+		EXPECT_LT(sqrtf(scalarProduct(Before, Before)), 1.E-3f);
+		auto Halfway = Gen.estimatePosition(i, 150000) - (Previous[i].position() + Current[i].position()) * 0.5f;
+		EXPECT_LT(sqrtf(scalarProduct(Halfway, Halfway)), 1.E-3f);
+	}
+	// a part of the sensors
+	Gen.estimatePositions(100, 110, 250000, Estimate.columns());
+	EXPECT_EQ(Estimate.sensorIds[0], Current[100].sensorId());
+	EXPECT_EQ(Estimate.x[9], Gen.estimatePosition(109, 250000).x());
+
+	// the queries did not change the generator or its random numbers
+	Gen.generateData(300000);
+	Untouched.generateData(300000);
+	for (std::size_t i = 0; i < Current.size(); ++i)
+	{
+		EXPECT_EQ(Gen.sensors().at(i).position().x(), Untouched.sensors().at(i).position().x());
+		EXPECT_EQ(Gen.sensors().at(i).position().y(), Untouched.sensors().at(i).position().y());
+	}
+}
+
+TEST(Generator, addAndRemoveSensors)
+{
+	using namespace PositionGenerator;
+	constexpr float radius = 2.f;
+	auto Param = GenerationParameter()
+		.setNumOfSensors(200)
+		.setRandomPolicy(RandomPolicy::CounterBased)
+		.setProximityRadius(radius)
+		.setSensorCapacity(300)
+		.setSeed(4);
+	Generator Gen(Param);
+	Gen.generateData(40000);
+
+	std::vector<sensorId_t> Removed = { 0, 57, 199 };
+	for (auto sensorId : Removed)
+		EXPECT_TRUE(Gen.removeSensor(sensorId));
+	EXPECT_FALSE(Gen.removeSensor(57));
+	EXPECT_EQ(Gen.grid(), nullptr);
+	std::vector<sensorId_t> Added;
+	for (int i = 0; i < 10; ++i)
+		Added.push_back(Gen.addSensor());
+	ASSERT_EQ(Gen.sensors().size(), 207u);
+
+	for (auto sensorId : Removed)
+	{
+		EXPECT_FALSE(Gen.indexOf(sensorId).has_value());
+		EXPECT_EQ(std::count(Added.begin(), Added.end(), sensorId), 0);
+	}
+	for (std::size_t i = 0; i < Gen.sensors().size(); ++i)
+	{
+		auto Sensor = Gen.sensors().at(i);
+		ASSERT_TRUE(Gen.indexOf(Sensor.sensorId()).has_value());
+		EXPECT_EQ(*Gen.indexOf(Sensor.sensorId()), i);
+	}
+	auto NewSensor = Gen.sensors().at(*Gen.indexOf(Added.front()));
+	EXPECT_EQ(NewSensor.timestamp(), 40000u);
+	EXPECT_GE(NewSensor.position().x(), Param.minValues().x());
+	EXPECT_LE(NewSensor.position().x(), Param.maxValues().x());
+
+	// the next tick moves all sensors and rebuilds the spatial index
+	Gen.generateData(80000);
+	ASSERT_NE(Gen.grid(), nullptr);
+	EXPECT_EQ(Gen.grid()->size(), Gen.sensors().size());
+	for (const auto& Sensor : Gen)
+		EXPECT_EQ(Sensor.timestamp(), 80000u);
+	std::size_t numPairs = 0;
+	const auto& Sensors = Gen.sensors();
+	for (std::size_t i = 0; i < Sensors.size(); ++i)
+		for (std::size_t j = i + 1; j < Sensors.size(); ++j)
+		{
+			auto Diff = Sensors.at(i).position() - Sensors.at(j).position();
+			numPairs += scalarProduct(Diff, Diff) <= radius * radius;
+		}
+	EXPECT_EQ(Gen.proximityEvents().size(), numPairs);
+}
+
+TEST(Generator, addSensorRejectsRates)
+{
+	using namespace PositionGenerator;
+	Generator Gen(GenerationParameter().setNumOfSensors(10).setSeed(7));
+	// without update rates every sensor moves on every tick, a rate could not be honoured
+	EXPECT_THROW(Gen.addSensor(50.), std::invalid_argument);
+	EXPECT_THROW(Gen.addSensor(-1.), std::invalid_argument);
+	EXPECT_EQ(Gen.sensors().size(), 10u);
+	EXPECT_NO_THROW(Gen.addSensor());
+
+	Generator WithRates(GenerationParameter().setNumOfSensors(10).setUpdateRates({ 10. }).setSeed(7));
+	EXPECT_THROW(WithRates.addSensor(-1.), std::invalid_argument);
+	EXPECT_THROW(WithRates.addSensor(std::numeric_limits<double>::infinity()), std::invalid_argument);
+	EXPECT_THROW(WithRates.addSensor(std::numeric_limits<double>::quiet_NaN()), std::invalid_argument);
+	// a failed call leaves no half inserted sensor behind
+	ASSERT_EQ(WithRates.sensors().size(), 10u);
+	EXPECT_TRUE(WithRates.removeSensor(0));
+	EXPECT_EQ(WithRates.sensors().size(), 9u);
+	EXPECT_NO_THROW(WithRates.addSensor(50.));
+	EXPECT_EQ(WithRates.sensors().size(), 10u);
+	WithRates.generateData(100000);
+	EXPECT_FALSE(WithRates.updatedSensors().empty());
+}
+
+TEST(Generator, noSensorChangesWhileRecording)
+{
+	using namespace PositionGenerator;
+	ChronoBasedGenerator Gen(GenerationParameter().setNumOfSensors(10).setSeed(8));
+	TickLog Log;
+	Gen.recordTo(&Log);
+	EXPECT_THROW(Gen.addSensor(), std::logic_error);
+	EXPECT_THROW(Gen.removeSensor(Gen.sensors().at(0).sensorId()), std::logic_error);
+	EXPECT_EQ(Gen.sensors().size(), 10u);
+
+	// allowed again once the recording stopped
+	Gen.recordTo(nullptr);
+	const sensorId_t sensorId = Gen.addSensor();
+	EXPECT_TRUE(Gen.removeSensor(sensorId));
+}
+
+TEST(Generator, addAndRemoveWithUpdateRates)
+{
+	using namespace PositionGenerator;
+	Generator Gen(GenerationParameter()
+		.setNumOfSensors(100)
+		.setRandomPolicy(RandomPolicy::CounterBased)
+		.setUpdateRates({ 10., 50. })
+		.setNumOfThreads(2)
+		.setShardSize(16)
+		.setSeed(6));
+	std::mt19937 Rnd(1);
+	std::map<sensorId_t, int> Updates;
+	for (timestamp_t t = 20000; t <= 2000000; t += 20000)
+	{
+		Gen.generateData(t);
+		for (auto index : Gen.updatedSensors())
+		{
+			ASSERT_LT(index, Gen.sensors().size());
+			EXPECT_EQ(Gen.sensors().at(index).timestamp(), t);
+			++Updates[Gen.sensors().at(index).sensorId()];
+		}
+		// a few sensors leave, others come at 50Hz
+		for (int i = 0; i < 3; ++i)
+			Gen.removeSensor(Gen.sensors().at(Rnd() % Gen.sensors().size()).sensorId());
+		for (int i = 0; i < 3; ++i)
+			Gen.addSensor(50.);
+		EXPECT_TRUE(Gen.updatedSensors().empty());
+	}
+	ASSERT_EQ(Gen.sensors().size(), 100u);
+	// the sensors that stayed the whole time kept their rate, 10Hz or 50Hz for 2 seconds
+	for (std::size_t i = 0; i < Gen.sensors().size(); ++i)
+	{
+		const auto sensorId = Gen.sensors().at(i).sensorId();
+		if (sensorId < 100)
+		{
+			const int updates = Updates[sensorId];
+			EXPECT_EQ(updates, Gen.updatePeriod(i) == 100000 ? 20 : 100) << "sensor " << sensorId;
+		}
+		else
+			EXPECT_EQ(Gen.updatePeriod(i), 20000u);
+	}
+}
+
+TEST(Generator, hugePages)
+{
+	using namespace PositionGenerator;
+	// large enough for huge page columns, the memory policy must not change the results
+	auto Param = GenerationParameter()
+		.setNumOfSensors(300000)
+		.setRandomPolicy(RandomPolicy::CounterBased)
+		.setNumOfThreads(2)
+		.setSensorCapacity(400000)
+		.setSeed(21);
+	Generator Default(Param);
+	Generator Huge(GenerationParameter(Param).setMemoryPolicy(MemoryPolicy::HugePages));
+	EXPECT_EQ(reinterpret_cast<uintptr_t>(Huge.sensors().posX()) % HugePageSize, 0u);
+	for (timestamp_t t = 100000; t <= 500000; t += 100000)
+	{
+		Default.generateData(t);
+		Huge.generateData(t);
+	}
+	// the placed capacity takes the added sensors without moving the columns
+	const float* pHugeX = Huge.sensors().posX();
+	for (int i = 0; i < 1000; ++i)
+	{
+		Default.addSensor();
+		Huge.addSensor();
+	}
+	EXPECT_EQ(Huge.sensors().posX(), pHugeX);
+	Default.generateData(600000);
+	Huge.generateData(600000);
+	ASSERT_EQ(Huge.sensors().size(), 301000u);
+	for (std::size_t i = 0; i < Default.sensors().size(); i += 97)
+	{
+		auto Expected = Default.sensors().at(i).position();
+		auto Pos = Huge.sensors().at(i).position();
+		EXPECT_EQ(Pos.x(), Expected.x());
+		EXPECT_EQ(Pos.y(), Expected.y());
+		EXPECT_EQ(Pos.z(), Expected.z());
+	}
+}
@@ -0,0 +1,41 @@
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "AlignedAllocator.h"
+#include "HugePages.h"
+
+TEST(HugePages, allocate)
+{
+	using namespace PositionGenerator;
+	const std::size_t bytes = HugePageSize + 1000;
+	auto* p = static_cast<uint8_t*>(allocateHugePages(bytes));
+	ASSERT_NE(p, nullptr);
+	EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % HugePageSize, 0u);
+	p[0] = 1;
+	p[bytes - 1] = 2;
+	EXPECT_EQ(p[0] + p[bytes - 1], 3);
+	freeHugePages(p, bytes);
+}
+
+TEST(HugePages, allocator)
+{
+	using namespace PositionGenerator;
+	using Vector_t = std::vector<float, AlignedAllocator<float>>;
+	// grows from heap blocks into huge pages and keeps the values on the way
+	Vector_t Values(AlignedAllocator<float>(MemoryPolicy::HugePages));
+	for (int i = 0; i < 1000000; ++i)
+		Values.push_back(static_cast<float>(i));
+	EXPECT_EQ(reinterpret_cast<uintptr_t>(Values.data()) % HugePageSize, 0u);
+	for (int i = 0; i < 1000000; i += 999)
+		ASSERT_EQ(Values[i], static_cast<float>(i));
+
+	// the policy moves with the memory
+	Vector_t Moved;
+	Moved = std::move(Values);
+	EXPECT_EQ(Moved.get_allocator().policy(), MemoryPolicy::HugePages);
+	EXPECT_EQ(Moved[999999], 999999.f);
+	EXPECT_NE(AlignedAllocator<float>(MemoryPolicy::HugePages), AlignedAllocator<float>());
+}
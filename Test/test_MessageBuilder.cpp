@@ -0,0 +1,189 @@
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "BufferPool.h"
+#include "Generator.h"
+#include "MessageBuilder.h"
+#include "PositionCodec.h"
+#include "TickSnapshot.h"
+
+namespace
+{
+	PositionGenerator::TickSnapshot testSnapshot(int numSensors, PositionGenerator::timestamp_t timestamp)
+	{
+		using namespace PositionGenerator;
+		Generator Gen(GenerationParameter().setNumOfSensors(numSensors).setRandomPolicy(RandomPolicy::CounterBased).setSeed(3));
+		Gen.generateData(timestamp);
+		TickSnapshot Snapshot;
+		Gen.captureSnapshot(Snapshot);
+		return Snapshot;
+	}
+}
+
+TEST(MessageBuilder, singleFrames)
+{
+	using namespace PositionGenerator;
+	const auto Snapshot = testSnapshot(50, 40000);
+	BufferPool Pool(1, tickBufferSize(PublishFormat(), Snapshot.size()));
+	MessageBuilder Builder(Pool);
+	TickFrames Frames;
+	Builder.buildTick(Snapshot, Frames);
+	EXPECT_EQ(Pool.numFree(), 0u);
+
+	// what zeromq gets: one frame per sensor, back to back in the tick buffer
+	struct Frame
+	{
+		const uint8_t* pData;
+		std::size_t size;
+		BufferPool::Buffer* pBuffer;
+	};
+	std::vector<Frame> Sent;
+	BufferPool::Buffer* pTickBuffer = Frames.pBuffer;
+	sendFrames(Frames, [&](const uint8_t* pData, std::size_t size, BufferPool::Buffer* pBuffer) { Sent.push_back({ pData, size, pBuffer }); });
+	EXPECT_EQ(Frames.pBuffer, nullptr);
+	ASSERT_EQ(Sent.size(), Snapshot.size());
+	const uint8_t* pNext = pTickBuffer->data();
+	for (std::size_t i = 0; i < Sent.size(); ++i)
+	{
+		EXPECT_EQ(Sent[i].pData, pNext);
+		EXPECT_EQ(Sent[i].pBuffer, pTickBuffer);
+		pNext += Sent[i].size;
+		GeneratedPosition Msg;
+		ASSERT_TRUE(Msg.ParseFromArray(Sent[i].pData, static_cast<int>(Sent[i].size)));
+		EXPECT_EQ(Msg.sensorid(), Snapshot.sensorIds[i]);
+		EXPECT_EQ(Msg.timestamp_usec(), Snapshot.timestamps[i]);
+		EXPECT_EQ(Msg.position().x(), Snapshot.x[i]);
+		EXPECT_EQ(Msg.position().y(), Snapshot.y[i]);
+		EXPECT_EQ(Msg.position().z(), Snapshot.z[i]);
+	}
+	EXPECT_EQ(pNext, pTickBuffer->data() + pTickBuffer->size());
+
+	// the frames still in flight keep the buffer out of the pool, the last one done with it gives it back
+	for (std::size_t i = 0; i < Sent.size(); ++i)
+	{
+		EXPECT_EQ(Pool.numFree(), 0u);
+		releaseFrame(const_cast<uint8_t*>(Sent[i].pData), Sent[i].pBuffer);
+	}
+	EXPECT_EQ(Pool.numFree(), 1u);
+	EXPECT_EQ(Pool.numAllocations(), 0u);
+}
+
+TEST(MessageBuilder, batchRoundTrip)
+{
+	using namespace PositionGenerator;
+	const auto Snapshot = testSnapshot(1000, 40000);
+	BufferPool Pool(1, 0);
+	PublishFormat Format;
+	Format.format = WireFormat::Batch;
+	Format.batchSize = 300;
+	MessageBuilder Builder(Pool, Format);
+	TickFrames Frames;
+	Builder.buildTick(Snapshot, Frames);
+
+	// 300, 300, 300 and the remaining 100 sensors
+	ASSERT_EQ(Frames.FrameEnd.size(), 4u);
+	EXPECT_EQ(Frames.FrameEnd.back(), Frames.pBuffer->size());
+	std::size_t begin = 0;
+	std::size_t sensor = 0;
+	for (auto end : Frames.FrameEnd)
+	{
+		GeneratedPositionBatch Batch;
+		ASSERT_TRUE(Batch.ParseFromArray(Frames.pBuffer->data() + begin, static_cast<int>(end - begin)));
+		ASSERT_EQ(Batch.sensorid_size(), sensor + 300 <= Snapshot.size() ? 300 : 100);
+		ASSERT_EQ(Batch.timestamp_usec_size(), Batch.sensorid_size());
+		ASSERT_EQ(Batch.x_size(), Batch.sensorid_size());
+		ASSERT_EQ(Batch.y_size(), Batch.sensorid_size());
+		ASSERT_EQ(Batch.z_size(), Batch.sensorid_size());
+		for (int i = 0; i < Batch.sensorid_size(); ++i, ++sensor)
+		{
+			EXPECT_EQ(Batch.sensorid(i), Snapshot.sensorIds[sensor]);
+			EXPECT_EQ(Batch.timestamp_usec(i), Snapshot.timestamps[sensor]);
+			EXPECT_EQ(Batch.x(i), Snapshot.x[sensor]);
+			EXPECT_EQ(Batch.y(i), Snapshot.y[sensor]);
+			EXPECT_EQ(Batch.z(i), Snapshot.z[sensor]);
+		}
+		begin = end;
+	}
+	EXPECT_EQ(sensor, Snapshot.size());
+	Frames.pBuffer->release();
+}
+
+TEST(MessageBuilder, deltaRoundTrip)
+{
+	using namespace PositionGenerator;
+	Generator Gen(GenerationParameter().setNumOfSensors(500).setRandomPolicy(RandomPolicy::CounterBased).setSeed(4));
+	BufferPool Pool(1, 0);
+	PublishFormat Format;
+	Format.format = WireFormat::Delta;
+	Format.batchSize = 200;
+	Format.keyframeInterval = 3;
+	MessageBuilder Builder(Pool, Format);
+	PositionDecoder Decoder;
+	TickSnapshot Snapshot;
+	TickFrames Frames;
+	EncodedTick Encoded;
+
+	for (int tick = 0; tick < 7; ++tick)
+	{
+		// tick 2 repeats tick 1, its deltas are all zero
+		if (tick != 2)
+			Gen.generateData((tick + 1) * 40000);
+		Gen.captureSnapshot(Snapshot);
+		Builder.buildTick(Snapshot, Frames);
+		ASSERT_EQ(Frames.FrameEnd.size(), 3u);
+
+		TickSnapshot Decoded;
+		std::size_t begin = 0;
+		for (auto end : Frames.FrameEnd)
+		{
+			GeneratedPositionDelta Delta;
+			ASSERT_TRUE(Delta.ParseFromArray(Frames.pBuffer->data() + begin, static_cast<int>(end - begin)));
+			EXPECT_EQ(Delta.keyframe(), tick % 3 == 0);
+			EXPECT_EQ(Delta.resolution(), Format.resolution);
+			EXPECT_EQ(Delta.timestamp_usec(), Snapshot.tickTimestamp);
+			const int n = Delta.sensorid_delta_size();
+			ASSERT_EQ(Delta.timestamp_offset_size(), n);
+			ASSERT_EQ(Delta.x_size(), n);
+			ASSERT_EQ(Delta.y_size(), n);
+			ASSERT_EQ(Delta.z_size(), n);
+
+			// back to an EncodedTick for the decoder, the ids are delta coded within the frame
+			Encoded.resize(static_cast<std::size_t>(n));
+			Encoded.keyframe = Delta.keyframe();
+			Encoded.resolution = Delta.resolution();
+			Encoded.tickTimestamp = Delta.timestamp_usec();
+			sensorId_t sensorId = 0;
+			for (int i = 0; i < n; ++i)
+			{
+				sensorId += static_cast<sensorId_t>(Delta.sensorid_delta(i));
+				Encoded.sensorIds[i] = sensorId;
+				Encoded.timestampOffsets[i] = Delta.timestamp_offset(i);
+				Encoded.x[i] = Delta.x(i);
+				Encoded.y[i] = Delta.y(i);
+				Encoded.z[i] = Delta.z(i);
+				if (tick == 2)
+				{
+					EXPECT_EQ(Delta.x(i), 0);
+					EXPECT_EQ(Delta.y(i), 0);
+					EXPECT_EQ(Delta.z(i), 0);
+				}
+			}
+			ASSERT_TRUE(Decoder.decode(Encoded, Decoded));
+			begin = end;
+		}
+		Frames.pBuffer->release();
+
+		ASSERT_EQ(Decoded.size(), Snapshot.size());
+		for (std::size_t i = 0; i < Snapshot.size(); ++i)
+		{
+			EXPECT_EQ(Decoded.sensorIds[i], Snapshot.sensorIds[i]);
+			EXPECT_EQ(Decoded.timestamps[i], Snapshot.timestamps[i]);
+			EXPECT_NEAR(Decoded.x[i], Snapshot.x[i], 0.0005f + 1.E-5f);
+			EXPECT_NEAR(Decoded.y[i], Snapshot.y[i], 0.0005f + 1.E-5f);
+			EXPECT_NEAR(Decoded.z[i], Snapshot.z[i], 0.0005f + 1.E-5f);
+		}
+	}
+}
@@ -0,0 +1,232 @@
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "CounterRandom.h"
+#include "MotionKernel.h"
+
+namespace
+{
+	// all columns of one batch, so we can run the same input through different kernels
+	struct BatchData
+	{
+		explicit BatchData(std::size_t count)
+			: timeInSec(count), randAcc(count), randDirX(count), randDirY(count)
+			, posX(count), posY(count), posZ(count), veloX(count), veloY(count), veloZ(count)
+		{}
+
+		PositionGenerator::MotionBatch batch()
+		{
+			PositionGenerator::MotionBatch B;
+			B.count = posX.size();
+			B.timeInSec = timeInSec.data();
+			B.randAcc = randAcc.data();
+			B.randDirX = randDirX.data();
+			B.randDirY = randDirY.data();
+			B.posX = posX.data();
+			B.posY = posY.data();
+			B.posZ = posZ.data();
+			B.veloX = veloX.data();
+			B.veloY = veloY.data();
+			B.veloZ = veloZ.data();
+			return B;
+		}
+
+		std::vector<float> timeInSec, randAcc, randDirX, randDirY;
+		std::vector<float> posX, posY, posZ, veloX, veloY, veloZ;
+	};
+}
+
+TEST(MotionKernel, simdMatchesScalar)
+{
+	using namespace PositionGenerator;
+	constexpr std::size_t numSensors = 1003; // not a multiple of the vector width, covers the tail
+
+	MotionLimits Limits;
+	Limits.maxVelocity = 12.f;
+	Limits.minValues = Vector3(0.f, 0.f, 0.2f);
+	Limits.maxValues = Vector3(100.f, 100.f, 1.5f);
+
+	std::mt19937 gen(4711);
+	std::uniform_real_distribution<float> dist;
+	BatchData Input(numSensors);
+	for (std::size_t i = 0; i < numSensors; ++i)
+	{
+		// include sensors without elapsed time and some sitting on the border
+		Input.timeInSec[i] = (i % 17 == 0) ? 0.f : dist(gen) * 0.1f;
+		Input.randAcc[i] = dist(gen);
+		Input.randDirX[i] = (i % 23 == 0) ? 0.5f : dist(gen);
+		Input.randDirY[i] = (i % 23 == 0) ? 0.5f : dist(gen);
+		Input.posX[i] = (i % 29 == 0) ? 100.f : dist(gen) * 100.f;
+		Input.posY[i] = dist(gen) * 100.f;
+		Input.posZ[i] = 0.5f;
+		Input.veloX[i] = (dist(gen) - 0.5f) * 2.f;
+		Input.veloY[i] = (dist(gen) - 0.5f) * 2.f;
+	}
+
+	BatchData Reference = Input;
+	advanceSensors(Reference.batch(), Limits, SimdLevel::Scalar);
+
+	for (auto level : { SimdLevel::AVX2, SimdLevel::AVX512 })
+	{
+		if (!isSimdLevelSupported(level))
+			continue;
+		BatchData Result = Input;
+		advanceSensors(Result.batch(), Limits, level);
+		for (std::size_t i = 0; i < numSensors; ++i)
+		{
+			EXPECT_EQ(Result.posX[i], Reference.posX[i]) << simdLevelName(level) << " sensor " << i;
+			EXPECT_EQ(Result.posY[i], Reference.posY[i]) << simdLevelName(level) << " sensor " << i;
+			EXPECT_EQ(Result.posZ[i], Reference.posZ[i]) << simdLevelName(level) << " sensor " << i;
+			EXPECT_EQ(Result.veloX[i], Reference.veloX[i]) << simdLevelName(level) << " sensor " << i;
+			EXPECT_EQ(Result.veloY[i], Reference.veloY[i]) << simdLevelName(level) << " sensor " << i;
+			EXPECT_EQ(Result.veloZ[i], Reference.veloZ[i]) << simdLevelName(level) << " sensor " << i;
+		}
+	}
+}
+
+TEST(MotionKernel, respectsLimits)
+{
+	using namespace PositionGenerator;
+	constexpr std::size_t numSensors = 64;
+
+	MotionLimits Limits;
+	Limits.maxVelocity = 10.f;
+	Limits.minValues = Vector3(10.f, 10.f, 0.2f);
+	Limits.maxValues = Vector3(110.f, 110.f, 1.5f);
+
+	std::mt19937 gen(42);
+	std::uniform_real_distribution<float> dist;
+	BatchData Data(numSensors);
+	for (std::size_t i = 0; i < numSensors; ++i)
+	{
+		Data.posX[i] = 10.f + dist(gen) * 100.f;
+		Data.posY[i] = 10.f + dist(gen) * 100.f;
+		Data.posZ[i] = 1.f;
+	}
+
+	for (int round = 0; round < 20; ++round)
+	{
+		for (std::size_t i = 0; i < numSensors; ++i)
+		{
+			Data.timeInSec[i] = 1.f;
+			Data.randAcc[i] = dist(gen);
+			Data.randDirX[i] = dist(gen);
+			Data.randDirY[i] = dist(gen);
+		}
+		BatchData Old = Data;
+		advanceSensors(Data.batch(), Limits);
+		for (std::size_t i = 0; i < numSensors; ++i)
+		{
+			float dx = Data.posX[i] - Old.posX[i];
+			float dy = Data.posY[i] - Old.posY[i];
+			EXPECT_LE(sqrtf(dx * dx + dy * dy), Limits.maxVelocity);
+			EXPECT_EQ(Data.posZ[i], Old.posZ[i]);
+			EXPECT_GE(Data.posX[i], Limits.minValues.x());
+			EXPECT_LE(Data.posX[i], Limits.maxValues.x());
+			EXPECT_GE(Data.posY[i], Limits.minValues.y());
+			EXPECT_LE(Data.posY[i], Limits.maxValues.y());
+		}
+	}
+}
+
+TEST(MotionKernel, noiseSimdMatchesScalar)
+{
+	using namespace PositionGenerator;
+	constexpr std::size_t count = 1003;
+
+	std::mt19937 gen(815);
+	std::uniform_real_distribution<float> dist;
+	std::vector<float> randIntensity(count), randDirX(count), randDirY(count), posX(count), posY(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		randIntensity[i] = dist(gen);
+		// direction without length has to give no noise
+		randDirX[i] = (i % 19 == 0) ? 0.5f : dist(gen);
+		randDirY[i] = (i % 19 == 0) ? 0.5f : dist(gen);
+		posX[i] = dist(gen) * 100.f;
+		posY[i] = dist(gen) * 100.f;
+	}
+
+	auto run = [&](SimdLevel level, std::vector<float>& outX, std::vector<float>& outY)
+	{
+		outX.resize(count);
+		outY.resize(count);
+		NoiseBatch Batch;
+		Batch.count = count;
+		Batch.noiseDimension = 0.3f;
+		Batch.randIntensity = randIntensity.data();
+		Batch.randDirX = randDirX.data();
+		Batch.randDirY = randDirY.data();
+		Batch.posX = posX.data();
+		Batch.posY = posY.data();
+		Batch.outX = outX.data();
+		Batch.outY = outY.data();
+		applyNoise(Batch, level);
+	};
+
+	std::vector<float> refX, refY;
+	run(SimdLevel::Scalar, refX, refY);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		float dx = refX[i] - posX[i];
+		float dy = refY[i] - posY[i];
+		EXPECT_LE(sqrtf(dx * dx + dy * dy), 0.3f * 1.001f);
+		if (i % 19 == 0)
+		{
+			EXPECT_EQ(refX[i], posX[i]);
+		}
+	}
+
+	for (auto level : { SimdLevel::AVX2, SimdLevel::AVX512 })
+	{
+		if (!isSimdLevelSupported(level))
+			continue;
+		std::vector<float> outX, outY;
+		run(level, outX, outY);
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			EXPECT_EQ(outX[i], refX[i]) << simdLevelName(level) << " position " << i;
+			EXPECT_EQ(outY[i], refY[i]) << simdLevelName(level) << " position " << i;
+		}
+	}
+}
+
+TEST(MotionKernel, uniformBatchMatchesCounterRandom)
+{
+	using namespace PositionGenerator;
+	constexpr std::size_t count = 1003;
+	CounterRandom Random(0x0123456789ABCDEFull);
+
+	// ids and ticks using the upper 32 bits as well
+	std::vector<uint64_t> sensorIds(count), ticks(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		sensorIds[i] = i * 0x100000001ull;
+		ticks[i] = 1000000ull * i + (static_cast<uint64_t>(i % 7) << 40);
+	}
+
+	for (auto level : { SimdLevel::Scalar, SimdLevel::AVX2, SimdLevel::AVX512 })
+	{
+		if (!isSimdLevelSupported(level))
+			continue;
+		std::vector<float> out0(count), out1(count), out2(count);
+		RandomBatch Batch;
+		Batch.count = count;
+		Batch.key = Random.key(RandomStream::Noise);
+		Batch.sensorIds = sensorIds.data();
+		Batch.ticks = ticks.data();
+		Batch.out0 = out0.data();
+		Batch.out1 = out1.data();
+		Batch.out2 = out2.data();
+		uniformBatch(Batch, level);
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			auto expected = Random.uniform(RandomStream::Noise, sensorIds[i], ticks[i]);
+			EXPECT_EQ(out0[i], expected[0]) << simdLevelName(level) << " element " << i;
+			EXPECT_EQ(out1[i], expected[1]) << simdLevelName(level) << " element " << i;
+			EXPECT_EQ(out2[i], expected[2]) << simdLevelName(level) << " element " << i;
+		}
+	}
+}
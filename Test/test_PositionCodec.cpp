@@ -0,0 +1,169 @@
+#include <cmath>
+#include <cstdint>
+#include <set>
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+
+#include "Generator.h"
+#include "PositionCodec.h"
+
+TEST(PositionCodec, keyframesAndDeltas)
+{
+	using namespace PositionGenerator;
+	Generator Gen(GenerationParameter().setNumOfSensors(100).setRandomPolicy(RandomPolicy::CounterBased).setSeed(5));
+	PositionEncoder Encoder(0.001f, 4);
+	PositionDecoder Decoder;
+	TickSnapshot Snapshot;
+	EncodedTick Encoded;
+
+	for (int tick = 0; tick < 10; ++tick)
+	{
+		Gen.generateData((tick + 1) * 40000);
+		Gen.captureSnapshot(Snapshot);
+		Encoder.encode(Snapshot, Encoded);
+		EXPECT_EQ(Encoded.keyframe, tick % 4 == 0);
+
+		TickSnapshot Decoded;
+		ASSERT_TRUE(Decoder.decode(Encoded, Decoded));
+		ASSERT_EQ(Decoded.size(), Snapshot.size());
+		EXPECT_EQ(Decoded.tickTimestamp, Snapshot.tickTimestamp);
+		for (std::size_t i = 0; i < Snapshot.size(); ++i)
+		{
+			EXPECT_EQ(Decoded.sensorIds[i], Snapshot.sensorIds[i]);
+			EXPECT_EQ(Decoded.timestamps[i], Snapshot.timestamps[i]);
+			// never more than half a step off, the deltas do not accumulate errors
+			EXPECT_NEAR(Decoded.x[i], Snapshot.x[i], 0.0005f + 1.E-5f);
+			EXPECT_NEAR(Decoded.y[i], Snapshot.y[i], 0.0005f + 1.E-5f);
+			EXPECT_NEAR(Decoded.z[i], Snapshot.z[i], 0.0005f + 1.E-5f);
+		}
+
+		// 40ms at 12m/s moves at most 0.48m, plus the noise, the deltas stay small
+		if (!Encoded.keyframe)
+		{
+			for (std::size_t i = 0; i < Encoded.size(); ++i)
+				EXPECT_LT(std::abs(Encoded.x[i]), 2000);
+		}
+	}
+}
+
+TEST(PositionCodec, keyframeOnNewSensors)
+{
+	using namespace PositionGenerator;
+	PositionEncoder Encoder(0.01f, 100);
+	TickSnapshot Snapshot;
+	Snapshot.resize(3);
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		Snapshot.sensorIds[i] = i;
+		Snapshot.x[i] = 1.f * i;
+	}
+	EncodedTick Encoded;
+	Encoder.encode(Snapshot, Encoded);
+	EXPECT_TRUE(Encoded.keyframe);
+	Encoder.encode(Snapshot, Encoded);
+	EXPECT_FALSE(Encoded.keyframe);
+	EXPECT_EQ(Encoded.x[2], 0);
+
+	Snapshot.sensorIds[1] = 7;
+	Encoder.encode(Snapshot, Encoded);
+	EXPECT_TRUE(Encoded.keyframe);
+
+	// a subset of known sensors is delta coded against their own last values
+	Snapshot.resize(2);
+	Encoder.encode(Snapshot, Encoded);
+	EXPECT_FALSE(Encoded.keyframe);
+	EXPECT_EQ(Encoded.x[0], 0);
+	EXPECT_EQ(Encoded.x[1], 0);
+
+	Encoder.forceKeyframe();
+	Encoder.encode(Snapshot, Encoded);
+	EXPECT_TRUE(Encoded.keyframe);
+
+	EXPECT_THROW(PositionEncoder(0.f), std::invalid_argument);
+}
+
+TEST(PositionCodec, deltaWithoutKeyframe)
+{
+	using namespace PositionGenerator;
+	PositionEncoder Encoder(0.01f, 100);
+	TickSnapshot Snapshot;
+	Snapshot.resize(2);
+	Snapshot.sensorIds[1] = 1;
+	EncodedTick Encoded;
+	Encoder.encode(Snapshot, Encoded);
+	Encoder.encode(Snapshot, Encoded);
+	ASSERT_FALSE(Encoded.keyframe);
+
+	// a subscriber that missed the keyframe skips the sensors until the next one
+	PositionDecoder Decoder;
+	TickSnapshot Decoded;
+	EXPECT_FALSE(Decoder.decode(Encoded, Decoded));
+	EXPECT_EQ(Decoded.size(), 0u);
+
+	Encoder.forceKeyframe();
+	Encoder.encode(Snapshot, Encoded);
+	EXPECT_TRUE(Decoder.decode(Encoded, Decoded));
+	EXPECT_EQ(Decoded.size(), 2u);
+}
+
+TEST(PositionCodec, saturate)
+{
+	using namespace PositionGenerator;
+	TickSnapshot Snapshot;
+	Snapshot.resize(3);
+	for (std::size_t i = 0; i < 3; ++i)
+		Snapshot.sensorIds[i] = i;
+	Snapshot.x = { 1.E30f, -INFINITY, NAN };
+	Snapshot.y = { 0.f, 0.f, 0.f };
+	Snapshot.z = { 0.f, 0.f, 0.f };
+	PositionEncoder Encoder(0.001f);
+	EncodedTick Encoded;
+	Encoder.encode(Snapshot, Encoded);
+	EXPECT_EQ(Encoded.x[0], 2147483520);
+	EXPECT_EQ(Encoded.x[1], -2147483520);
+	EXPECT_EQ(Encoded.x[2], -2147483520);
+}
+
+TEST(PositionCodec, deltasForDueSensors)
+{
+	using namespace PositionGenerator;
+	// with update rates every tick holds another subset of the sensors
+	Generator Gen(GenerationParameter()
+		.setNumOfSensors(1000)
+		.setRandomPolicy(RandomPolicy::CounterBased)
+		.setUpdateRates({ 10., 200. })
+		.setSeed(9));
+	PositionEncoder Encoder(0.001f, 50);
+	PositionDecoder Decoder;
+	TickSnapshot Snapshot;
+	EncodedTick Encoded;
+	// sensors decoded at least once
+	std::set<sensorId_t> Seen;
+
+	int numKeyframes = 0;
+	constexpr int numTicks = 400;
+	for (int tick = 1; tick <= numTicks; ++tick)
+	{
+		Gen.generateData(tick * 5000); // 200Hz
+		Gen.captureUpdates(Snapshot);
+		Encoder.encode(Snapshot, Encoded);
+		numKeyframes += Encoded.keyframe;
+
+		TickSnapshot Decoded;
+		ASSERT_TRUE(Decoder.decode(Encoded, Decoded));
+		ASSERT_EQ(Decoded.size(), Snapshot.size());
+		for (std::size_t i = 0; i < Decoded.size(); ++i)
+		{
+			EXPECT_EQ(Decoded.sensorIds[i], Snapshot.sensorIds[i]);
+			EXPECT_NEAR(Decoded.x[i], Snapshot.x[i], 0.0005f + 1.E-5f);
+			EXPECT_NEAR(Decoded.y[i], Snapshot.y[i], 0.0005f + 1.E-5f);
+			EXPECT_NEAR(Decoded.z[i], Snapshot.z[i], 0.0005f + 1.E-5f);
+			Seen.insert(Decoded.sensorIds[i]);
+		}
+	}
+	EXPECT_EQ(Seen.size(), Gen.sensors().size());
+	// the 200Hz sensors force a keyframe every 50 ticks, the phases of the 10Hz sensors every 1000 ticks at most
+	EXPECT_GE(numKeyframes, numTicks / 50);
+	EXPECT_LT(numKeyframes, numTicks / 5);
+}
@@ -0,0 +1,225 @@
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "Generator.h"
+#include "MappedFile.h"
+#include "PositionDataset.h"
+
+namespace
+{
+	std::string tempFile(const char* name)
+	{
+		return (std::filesystem::temp_directory_path() / name).string();
+	}
+
+	template <typename T>
+	const T* column(const PositionGenerator::MappedFile& File, const PositionGenerator::DatasetHeader& Header,
+		const PositionGenerator::TickIndexEntry& Entry, PositionGenerator::DatasetColumn Column)
+	{
+		return reinterpret_cast<const T*>(File.data() + Entry.offset + Header.columnOffset[static_cast<std::size_t>(Column)]);
+	}
+
+	void overwrite(const std::string& fileName, std::size_t offset, uint64_t value)
+	{
+		std::fstream File(fileName, std::ios::binary | std::ios::in | std::ios::out);
+		File.seekp(static_cast<std::streamoff>(offset));
+		File.write(reinterpret_cast<const char*>(&value), sizeof(value));
+	}
+}
+
+TEST(PositionDataset, layout)
+{
+	using namespace PositionGenerator;
+	auto Header = makeDatasetHeader(1001, 10);
+	EXPECT_EQ(std::memcmp(Header.magic, DatasetMagic, sizeof(DatasetMagic)), 0);
+	EXPECT_EQ(Header.indexOffset % CacheLineSize, 0u);
+	EXPECT_EQ(Header.dataOffset % CacheLineSize, 0u);
+	EXPECT_GE(Header.dataOffset, Header.indexOffset + 10 * sizeof(TickIndexEntry));
+	EXPECT_EQ(Header.blockSize % CacheLineSize, 0u);
+	EXPECT_GE(Header.blockSize, 1001u * (2 * sizeof(uint64_t) + 3 * sizeof(float)));
+	for (auto offset : Header.columnOffset)
+		EXPECT_EQ(offset % CacheLineSize, 0u);
+}
+
+TEST(PositionDataset, generateAndMap)
+{
+	using namespace PositionGenerator;
+	constexpr std::size_t numTicks = 20;
+	constexpr timestamp_t tickInterval = 40000;
+	auto Param = GenerationParameter()
+		.setNumOfSensors(100)
+		.setRandomPolicy(RandomPolicy::CounterBased)
+		.setSeed(99);
+
+	auto fileName = tempFile("posgen_dataset_test.bin");
+	Generator Gen(Param);
+	auto fileSize = generateDataset(Gen, fileName, numTicks, tickInterval);
+
+	// second generator with the same seed as reference
+	Generator Reference(Param);
+	TickSnapshot Snapshot;
+	{
+		auto File = MappedFile::openReadOnly(fileName);
+		ASSERT_EQ(File.size(), fileSize);
+		const auto& Header = *reinterpret_cast<const DatasetHeader*>(File.data());
+		EXPECT_EQ(Header.version, DatasetVersion);
+		EXPECT_EQ(Header.numSensors, 100u);
+		EXPECT_EQ(Header.numTicks, numTicks);
+		EXPECT_EQ(Header.seed, 99u);
+		EXPECT_EQ(Header.timestampUnitsPerSecond, Param.timeStampPerSecond());
+
+		const auto* pIndex = reinterpret_cast<const TickIndexEntry*>(File.data() + Header.indexOffset);
+		for (std::size_t tick = 0; tick < numTicks; ++tick)
+		{
+			const TickIndexEntry& Entry = pIndex[tick];
+			Reference.generateData((tick + 1) * tickInterval);
+			Reference.captureSnapshot(Snapshot);
+			ASSERT_EQ(Entry.tickTimestamp, (tick + 1) * tickInterval);
+			ASSERT_EQ(Entry.numRecords, Snapshot.size());
+
+			const auto* sensorIds = column<sensorId_t>(File, Header, Entry, DatasetColumn::SensorId);
+			const auto* timestamps = column<timestamp_t>(File, Header, Entry, DatasetColumn::Timestamp);
+			const auto* x = column<float>(File, Header, Entry, DatasetColumn::X);
+			const auto* y = column<float>(File, Header, Entry, DatasetColumn::Y);
+			const auto* z = column<float>(File, Header, Entry, DatasetColumn::Z);
+			for (std::size_t i = 0; i < Snapshot.size(); ++i)
+			{
+				EXPECT_EQ(sensorIds[i], Snapshot.sensorIds[i]);
+				EXPECT_EQ(timestamps[i], Snapshot.timestamps[i]);
+				EXPECT_EQ(x[i], Snapshot.x[i]);
+				EXPECT_EQ(y[i], Snapshot.y[i]);
+				EXPECT_EQ(z[i], Snapshot.z[i]);
+			}
+		}
+	}
+	std::remove(fileName.c_str());
+}
+
+TEST(PositionDataset, writerIsBounded)
+{
+	using namespace PositionGenerator;
+	auto fileName = tempFile("posgen_dataset_bounded.bin");
+	{
+		DatasetWriter Writer(fileName, 10, 2, 1000000, 0);
+		Writer.appendTick(1);
+		Writer.appendTick(2);
+		EXPECT_EQ(Writer.numTicks(), 2u);
+		EXPECT_THROW(Writer.appendTick(3), std::length_error);
+	}
+	std::remove(fileName.c_str());
+	EXPECT_THROW(MappedFile::openReadOnly(fileName), std::runtime_error);
+}
+
+TEST(PositionDataset, readerWalksIndex)
+{
+	using namespace PositionGenerator;
+	constexpr std::size_t numTicks = 10;
+	auto Param = GenerationParameter()
+		.setNumOfSensors(50)
+		.setRandomPolicy(RandomPolicy::CounterBased)
+		.setSeed(7);
+
+	auto fileName = tempFile("posgen_dataset_reader.bin");
+	Generator Gen(Param);
+	generateDataset(Gen, fileName, numTicks, 1000);
+
+	Generator Reference(Param);
+	TickSnapshot Snapshot;
+	{
+		DatasetReader Reader(fileName);
+		ASSERT_EQ(Reader.numTicks(), numTicks);
+		EXPECT_EQ(Reader.numSensors(), 50u);
+		EXPECT_EQ(Reader.header().seed, 7u);
+		for (std::size_t tick = 0; tick < numTicks; ++tick)
+		{
+			Reference.generateData((tick + 1) * 1000);
+			Reference.captureSnapshot(Snapshot);
+			auto Tick = Reader.tick(tick);
+			EXPECT_EQ(Tick.tickTimestamp, (tick + 1) * 1000);
+			ASSERT_EQ(Tick.numRecords, Snapshot.size());
+			EXPECT_EQ(Tick.blockSize, Reader.header().blockSize);
+			EXPECT_EQ(reinterpret_cast<uintptr_t>(Tick.pBlock) % CacheLineSize, 0u);
+			for (std::size_t i = 0; i < Tick.numRecords; ++i)
+			{
+				EXPECT_EQ(Tick.sensorIds[i], Snapshot.sensorIds[i]);
+				EXPECT_EQ(Tick.timestamps[i], Snapshot.timestamps[i]);
+				EXPECT_EQ(Tick.x[i], Snapshot.x[i]);
+				EXPECT_EQ(Tick.y[i], Snapshot.y[i]);
+				EXPECT_EQ(Tick.z[i], Snapshot.z[i]);
+			}
+		}
+	}
+	std::remove(fileName.c_str());
+}
+
+TEST(PositionDataset, readerRejectsBrokenFiles)
+{
+	using namespace PositionGenerator;
+	auto fileName = tempFile("posgen_dataset_broken.bin");
+	Generator Gen(GenerationParameter().setNumOfSensors(20));
+	generateDataset(Gen, fileName, 5, 1000);
+
+	// truncated in the middle of the tick data
+	std::filesystem::resize_file(fileName, std::filesystem::file_size(fileName) - 100);
+	EXPECT_THROW(DatasetReader Reader(fileName), std::runtime_error);
+
+	// not a dataset at all
+	std::filesystem::resize_file(fileName, 64);
+	EXPECT_THROW(DatasetReader Reader(fileName), std::runtime_error);
+	std::remove(fileName.c_str());
+}
+
+TEST(PositionDataset, readerRejectsHugeCounts)
+{
+	using namespace PositionGenerator;
+	auto fileName = tempFile("posgen_dataset_counts.bin");
+	Generator Gen(GenerationParameter().setNumOfSensors(20));
+	generateDataset(Gen, fileName, 5, 1000);
+
+	// 2^59 ticks: the index size and all block offsets wrap around to 0, so a header and index made
+	// consistent with the wrapped values describe a layout that seems to fit the file
+	constexpr uint64_t maxTicks = uint64_t(1) << 59;
+	const DatasetHeader Wrapped = makeDatasetHeader(20, maxTicks);
+	ASSERT_LE(Wrapped.dataOffset, std::filesystem::file_size(fileName));
+	overwrite(fileName, offsetof(DatasetHeader, maxTicks), maxTicks);
+	overwrite(fileName, offsetof(DatasetHeader, dataOffset), Wrapped.dataOffset);
+	for (uint64_t tick = 0; tick < 5; ++tick)
+		overwrite(fileName, Wrapped.indexOffset + tick * sizeof(TickIndexEntry) + offsetof(TickIndexEntry, offset),
+			Wrapped.dataOffset + tick * Wrapped.blockSize);
+	EXPECT_THROW(DatasetReader Reader(fileName), std::runtime_error);
+
+	// a sensor count whose columns do not fit into 64 bit
+	generateDataset(Gen, fileName, 5, 1000);
+	overwrite(fileName, offsetof(DatasetHeader, numSensors), std::numeric_limits<uint64_t>::max() / 4);
+	EXPECT_THROW(DatasetReader Reader(fileName), std::runtime_error);
+	std::remove(fileName.c_str());
+}
+
+TEST(PositionDataset, withoutSensors)
+{
+	using namespace PositionGenerator;
+	auto fileName = tempFile("posgen_dataset_empty.bin");
+	Generator Gen(GenerationParameter().setNumOfSensors(0));
+	generateDataset(Gen, fileName, 3, 1000);
+	{
+		DatasetReader Reader(fileName);
+		EXPECT_EQ(Reader.numSensors(), 0u);
+		ASSERT_EQ(Reader.numTicks(), 3u);
+		for (std::size_t tick = 0; tick < 3; ++tick)
+		{
+			auto Tick = Reader.tick(tick);
+			EXPECT_EQ(Tick.tickTimestamp, (tick + 1) * 1000);
+			EXPECT_EQ(Tick.numRecords, 0u);
+			EXPECT_EQ(Tick.blockSize, 0u);
+		}
+	}
+	std::remove(fileName.c_str());
+}
@@ -0,0 +1,56 @@
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "BufferPool.h"
+#include "MessageBuilder.h"
+#include "PublishPipeline.h"
+
+TEST(PublishPipeline, allTicksInOrder)
+{
+	using namespace PositionGenerator;
+	constexpr uint64_t numTicks = 500;
+	constexpr std::size_t numSensors = 3;
+	BufferPool Pool(4, tickBufferSize(PublishFormat(), numSensors));
+	MessageBuilder Builder(Pool);
+	// only the sender thread touches Received until stop() joined it
+	std::vector<uint64_t> Received;
+	{
+		PublishPipeline Pipeline(Builder, [&](TickFrames& Frames)
+			{
+				ASSERT_EQ(Frames.FrameEnd.size(), numSensors);
+				sendFrames(Frames, [&](uint8_t* pData, std::size_t size, BufferPool::Buffer* pBuffer)
+					{
+						GeneratedPosition Msg;
+						EXPECT_TRUE(Msg.ParseFromArray(pData, static_cast<int>(size)));
+						if (Msg.sensorid() == 0)
+							Received.push_back(Msg.timestamp_usec());
+						releaseFrame(pData, pBuffer);
+					});
+			}, 4);
+
+		for (uint64_t tick = 1; tick <= numTicks; ++tick)
+		{
+			TickSnapshot* pSnapshot = Pipeline.acquireSnapshot();
+			pSnapshot->resize(numSensors);
+			pSnapshot->tickTimestamp = tick;
+			for (std::size_t i = 0; i < numSensors; ++i)
+			{
+				pSnapshot->sensorIds[i] = i;
+				pSnapshot->timestamps[i] = tick;
+				pSnapshot->x[i] = pSnapshot->y[i] = pSnapshot->z[i] = static_cast<float>(tick);
+			}
+			Pipeline.submit(pSnapshot);
+		}
+		// finishes the submitted ticks
+		Pipeline.stop();
+	}
+
+	ASSERT_EQ(Received.size(), numTicks);
+	for (uint64_t tick = 1; tick <= numTicks; ++tick)
+		EXPECT_EQ(Received[tick - 1], tick);
+	// at most one tick per frame list in flight, every tick buffer went back
+	EXPECT_EQ(Pool.numAllocations(), 0u);
+	EXPECT_EQ(Pool.numFree(), 4u);
+}
@@ -0,0 +1,92 @@
+#include <cstdint>
+#include <iterator>
+
+#include "gtest/gtest.h"
+
+#include "SensorStore.h"
+
+TEST(SensorStore, storeAndIterate)
+{
+	using namespace PositionGenerator;
+	constexpr int numSensors = 100;
+
+	SensorStore Store;
+	for (int i = 0; i < numSensors; ++i)
+	{
+		SensorPosition Sensor(i, 1000 + i, Vector3(float(i), 2.f * i, 0.5f));
+		Sensor.setVelocity(Vector3(1.f, -1.f, 0.f));
+		Store.push_back(Sensor);
+	}
+	EXPECT_EQ(Store.size(), numSensors);
+	EXPECT_EQ(std::distance(Store.begin(), Store.end()), numSensors);
+
+	int i = 0;
+	for (const auto& Sensor : Store)
+	{
+		EXPECT_EQ(Sensor.sensorId(), i);
+		EXPECT_EQ(Sensor.timestamp(), 1000 + i);
+		EXPECT_EQ(Sensor.position().x(), float(i));
+		EXPECT_EQ(Sensor.position().y(), 2.f * i);
+		EXPECT_EQ(Sensor.velocity().y(), -1.f);
+		++i;
+	}
+
+	// random access and update through the columns
+	auto it = Store.begin() + 42;
+	EXPECT_EQ((*it).sensorId(), 42);
+	Store.posZ()[42] = 1.25f;
+	EXPECT_EQ(Store.at(42).position().z(), 1.25f);
+}
+
+TEST(SensorStore, eraseUnordered)
+{
+	using namespace PositionGenerator;
+	SensorStore Store;
+	for (int i = 0; i < 5; ++i)
+		Store.push_back(SensorPosition(i, 100 + i, Vector3(float(i), 0.f, 1.f)));
+
+	// the last one fills the gap
+	Store.eraseUnordered(1);
+	ASSERT_EQ(Store.size(), 4u);
+	EXPECT_EQ(Store.at(1).sensorId(), 4u);
+	EXPECT_EQ(Store.at(1).timestamp(), 104u);
+	EXPECT_EQ(Store.at(1).position().x(), 4.f);
+	EXPECT_EQ(Store.at(3).sensorId(), 3u);
+
+	Store.eraseUnordered(3);
+	ASSERT_EQ(Store.size(), 3u);
+	EXPECT_EQ(Store.at(2).sensorId(), 2u);
+}
+
+TEST(SensorStore, columnAlignment)
+{
+	using namespace PositionGenerator;
+	SensorStore Store;
+	for (int i = 0; i < 17; ++i)
+		Store.push_back(SensorPosition(i, 0, Vector3(0.f, 0.f, 0.f)));
+
+	auto isAligned = [](const void* p) { return reinterpret_cast<std::uintptr_t>(p) % CacheLineSize == 0; };
+	EXPECT_TRUE(isAligned(Store.sensorIds()));
+	EXPECT_TRUE(isAligned(Store.timestamps()));
+	EXPECT_TRUE(isAligned(Store.posX()));
+	EXPECT_TRUE(isAligned(Store.posY()));
+	EXPECT_TRUE(isAligned(Store.posZ()));
+	EXPECT_TRUE(isAligned(Store.veloX()));
+	EXPECT_TRUE(isAligned(Store.veloY()));
+	EXPECT_TRUE(isAligned(Store.veloZ()));
+}
+
+TEST(SensorStore, touchCapacity)
+{
+	using namespace PositionGenerator;
+	SensorStore Store(MemoryPolicy::HugePages);
+	Store.reserve(100);
+	Store.push_back(SensorPosition(7, 1, Vector3(1.f, 2.f, 3.f)));
+	// only the unused capacity is written, the sensor stays as it is
+	Store.touchCapacity(0, 1000);
+	ASSERT_EQ(Store.size(), 1u);
+	EXPECT_EQ(Store.at(0).sensorId(), 7u);
+	EXPECT_EQ(Store.at(0).position().y(), 2.f);
+	Store.push_back(SensorPosition(8, 1, Vector3()));
+	EXPECT_EQ(Store.at(1).sensorId(), 8u);
+}
@@ -0,0 +1,127 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "Settings.h"
+
+namespace
+{
+	std::string tempFile(const char* name)
+	{
+		return (std::filesystem::temp_directory_path() / name).string();
+	}
+}
+
+TEST(Settings, typedValues)
+{
+	using namespace PositionGenerator;
+	Settings Config;
+	Config.set("count", "100000");
+	Config.set("offset", "-5");
+	Config.set("rate", "2.5");
+	Config.set("on", "yes");
+	Config.set("min", "0, 1.5,-2");
+	Config.set("name", "tcp://*:4646");
+
+	EXPECT_EQ(Config.getUInt("count", 0), 100000u);
+	EXPECT_EQ(Config.getInt("offset", 0), -5);
+	EXPECT_EQ(Config.getDouble("rate", 0.), 2.5);
+	EXPECT_TRUE(Config.getBool("on", false));
+	auto Min = Config.getVector("min", Vector3());
+	EXPECT_EQ(Min.x(), 0.f);
+	EXPECT_EQ(Min.y(), 1.5f);
+	EXPECT_EQ(Min.z(), -2.f);
+	EXPECT_EQ(Config.getString("name", ""), "tcp://*:4646");
+	EXPECT_EQ(Config.getDouble("missing", 7.), 7.);
+	Config.set("rates", "10, 200,0.5");
+	EXPECT_EQ(Config.getList("rates", {}), (std::vector<double>{ 10., 200., 0.5 }));
+	EXPECT_TRUE(Config.unusedKeys().empty());
+
+	Config.set("count", "12k");
+	EXPECT_THROW(Config.getUInt("count", 0), std::invalid_argument);
+	Config.set("min", "1,2");
+	EXPECT_THROW(Config.getVector("min", Vector3()), std::invalid_argument);
+	Config.set("min", "1,2,3,4");
+	EXPECT_THROW(Config.getVector("min", Vector3()), std::invalid_argument);
+	Config.set("rates", "10,,200");
+	EXPECT_THROW(Config.getList("rates", {}), std::invalid_argument);
+	Config.set("on", "maybe");
+	EXPECT_THROW(Config.getBool("on", false), std::invalid_argument);
+
+	Config.set("sensros", "10");
+	ASSERT_EQ(Config.unusedKeys().size(), 1u);
+	EXPECT_EQ(Config.unusedKeys().front(), "sensros");
+}
+
+TEST(Settings, fileAndCommandLine)
+{
+	using namespace PositionGenerator;
+	auto fileName = tempFile("posgen_settings_test.cfg");
+	{
+		std::ofstream Out(fileName);
+		Out << "# load test\n"
+			<< "sensors = 100000   # a lot\n"
+			<< "\n"
+			<< "random = philox\n"
+			<< "threads = 8\n";
+	}
+	const std::string File = fileName;
+	const char* argv[] = { "PosGen", "--threads", "2", "--config", File.c_str(), "--sensors", "500", "--seed", "42" };
+	Settings Config;
+	Config.parseCommandLine(static_cast<int>(std::size(argv)), argv);
+	std::remove(fileName.c_str());
+
+	// the file overrides options before it, options after it override the file
+	auto Param = generationParameter(Config, GenerationParameter().setNoiseDimension(0.1f));
+	EXPECT_EQ(Param.numOfSensors(), 500);
+	EXPECT_EQ(Param.numOfThreads(), 8);
+	EXPECT_EQ(Param.randomPolicy(), RandomPolicy::CounterBased);
+	ASSERT_TRUE(Param.seed().has_value());
+	EXPECT_EQ(*Param.seed(), 42u);
+	// not set, kept from the defaults
+	EXPECT_EQ(Param.noiseDimension(), 0.1f);
+	EXPECT_EQ(Param.maxVelocity(), GenerationParameter().maxVelocity());
+
+	const char* missingValue[] = { "PosGen", "--sensors" };
+	EXPECT_THROW(Config.parseCommandLine(2, missingValue), std::invalid_argument);
+	const char* noKey[] = { "PosGen", "sensors", "5" };
+	EXPECT_THROW(Config.parseCommandLine(3, noKey), std::invalid_argument);
+	EXPECT_THROW(Config.loadFile(tempFile("posgen_settings_does_not_exist.cfg")), std::runtime_error);
+
+	Config.set("threads", "-2");
+	EXPECT_THROW(generationParameter(Config), std::invalid_argument);
+	EXPECT_THROW(GenerationParameter().setNumOfThreads(-1), std::invalid_argument);
+	Config.set("threads", "2");
+
+	// beyond int, not truncated to 10 sensors
+	Config.set("sensors", "4294967306");
+	EXPECT_THROW(generationParameter(Config), std::invalid_argument);
+	Config.set("sensors", "-1");
+	EXPECT_THROW(generationParameter(Config), std::invalid_argument);
+	Config.set("sensors", "2147483647");
+	EXPECT_EQ(generationParameter(Config).numOfSensors(), 2147483647);
+	Config.set("sensors", "500");
+	Config.set("threads", "4294967297");
+	EXPECT_THROW(generationParameter(Config), std::invalid_argument);
+	Config.set("threads", "2");
+	Config.set("shard-size", "2147483648");
+	EXPECT_THROW(generationParameter(Config), std::invalid_argument);
+	Config.set("shard-size", "0");
+	EXPECT_THROW(generationParameter(Config), std::invalid_argument);
+	Config.set("shard-size", "64");
+	EXPECT_EQ(generationParameter(Config).shardSize(), 64);
+
+	Config.set("memory", "huge-pages");
+	EXPECT_EQ(generationParameter(Config).memoryPolicy(), MemoryPolicy::HugePages);
+	Config.set("memory", "lots");
+	EXPECT_THROW(generationParameter(Config), std::invalid_argument);
+	Config.set("memory", "default");
+
+	Config.set("random", "dice");
+	EXPECT_THROW(generationParameter(Config), std::invalid_argument);
+}
@@ -0,0 +1,129 @@
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "Generator.h"
+#include "SharedSnapshot.h"
+
+TEST(SharedSnapshot, publishAndRead)
+{
+	using namespace PositionGenerator;
+	SharedSnapshot Shared(2);
+	EXPECT_FALSE(Shared.acquire());
+	EXPECT_FALSE(Shared.publish());
+
+	TickSnapshot* pSnapshot = Shared.writeBuffer();
+	ASSERT_NE(pSnapshot, nullptr);
+	EXPECT_EQ(Shared.writeBuffer(), pSnapshot);
+	pSnapshot->tickTimestamp = 1;
+	EXPECT_TRUE(Shared.publish());
+
+	auto First = Shared.acquire();
+	ASSERT_TRUE(First);
+	EXPECT_EQ(First->tickTimestamp, 1u);
+	EXPECT_EQ(First.epoch(), 1u);
+
+	// the reader keeps its snapshot while the writer goes on
+	pSnapshot = Shared.writeBuffer();
+	ASSERT_NE(pSnapshot, nullptr);
+	pSnapshot->tickTimestamp = 2;
+	EXPECT_TRUE(Shared.publish());
+	EXPECT_EQ(First->tickTimestamp, 1u);
+	EXPECT_EQ(Shared.acquire()->tickTimestamp, 2u);
+
+	// with two buffers the only spare one is still read, the writer skips instead of waiting
+	EXPECT_EQ(Shared.writeBuffer(), nullptr);
+	EXPECT_EQ(Shared.numSkipped(), 1u);
+	First.release();
+	EXPECT_FALSE(First);
+	ASSERT_NE(Shared.writeBuffer(), nullptr);
+	EXPECT_TRUE(Shared.publish());
+	EXPECT_EQ(Shared.numPublished(), 3u);
+
+	EXPECT_THROW(SharedSnapshot(1), std::invalid_argument);
+}
+
+TEST(SharedSnapshot, concurrentReaders)
+{
+	using namespace PositionGenerator;
+	constexpr std::size_t numSensors = 256;
+	constexpr uint64_t numPublishes = 20000;
+	SharedSnapshot Shared;
+	std::atomic_bool Done = false;
+	std::atomic<uint64_t> numInconsistent = 0;
+	std::atomic<uint64_t> numReads = 0;
+
+	std::vector<std::thread> Readers;
+	for (int r = 0; r < 4; ++r)
+		Readers.emplace_back([&]
+			{
+				uint64_t lastEpoch = 0;
+				while (!Done.load(std::memory_order_relaxed))
+				{
+					auto Snapshot = Shared.acquire();
+					if (!Snapshot)
+						continue;
+					// the writer fills every value of a snapshot with its epoch, a torn read would mix two epochs
+					const float expected = static_cast<float>(Snapshot.epoch());
+					bool consistent = Snapshot.epoch() >= lastEpoch && Snapshot->tickTimestamp == Snapshot.epoch();
+					for (std::size_t i = 0; i < Snapshot->size(); ++i)
+						consistent &= Snapshot->x[i] == expected && Snapshot->sensorIds[i] == Snapshot.epoch();
+					if (!consistent)
+						numInconsistent.fetch_add(1);
+					lastEpoch = Snapshot.epoch();
+					numReads.fetch_add(1, std::memory_order_relaxed);
+				}
+			});
+
+	// keeps publishing until a reader got through, on a single core the readers might not have run before
+	uint64_t published = 0;
+	while (published < numPublishes || numReads.load(std::memory_order_relaxed) == 0)
+	{
+		TickSnapshot* pSnapshot = Shared.writeBuffer();
+		if (!pSnapshot)
+			continue;
+		const uint64_t epoch = Shared.numPublished() + 1;
+		pSnapshot->resize(numSensors);
+		pSnapshot->tickTimestamp = epoch;
+		for (std::size_t i = 0; i < numSensors; ++i)
+		{
+			pSnapshot->sensorIds[i] = epoch;
+			pSnapshot->x[i] = static_cast<float>(epoch);
+		}
+		Shared.publish();
+		if (++published >= numPublishes)
+			std::this_thread::yield();
+	}
+	Done = true;
+	for (auto& Thread : Readers)
+		Thread.join();
+
+	EXPECT_EQ(numInconsistent.load(), 0u);
+	EXPECT_GT(numReads.load(), 0u);
+	EXPECT_EQ(Shared.numPublished(), published);
+}
+
+TEST(SharedSnapshot, generator)
+{
+	using namespace PositionGenerator;
+	Generator Gen(GenerationParameter().setNumOfSensors(100).setRandomPolicy(RandomPolicy::CounterBased));
+	SharedSnapshot Shared;
+	Gen.generateData(40000);
+	ASSERT_TRUE(Gen.publishSnapshot(Shared));
+
+	TickSnapshot Expected;
+	Gen.captureSnapshot(Expected);
+	auto Snapshot = Shared.acquire();
+	ASSERT_TRUE(Snapshot);
+	EXPECT_EQ(Snapshot->tickTimestamp, 40000u);
+	ASSERT_EQ(Snapshot->size(), Expected.size());
+	for (std::size_t i = 0; i < Expected.size(); ++i)
+	{
+		EXPECT_EQ(Snapshot->sensorIds[i], Expected.sensorIds[i]);
+		EXPECT_EQ(Snapshot->x[i], Expected.x[i]);
+	}
+}
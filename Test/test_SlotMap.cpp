@@ -0,0 +1,71 @@
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "SlotMap.h"
+
+TEST(SlotMap, stableIds)
+{
+	using namespace PositionGenerator;
+	SlotMap Ids;
+	for (SlotMap::index_t i = 0; i < 4; ++i)
+		EXPECT_EQ(Ids.insert(i), i);
+	EXPECT_EQ(Ids.size(), 4u);
+	EXPECT_EQ(Ids.find(2), 2u);
+
+	EXPECT_TRUE(Ids.erase(1));
+	EXPECT_FALSE(Ids.erase(1));
+	EXPECT_FALSE(Ids.contains(1));
+	EXPECT_EQ(Ids.find(1), SlotMap::Invalid);
+	EXPECT_EQ(Ids.size(), 3u);
+
+	// the slot is reused, but the id is a new one
+	auto Reused = Ids.insert(7);
+	EXPECT_NE(Reused, 1u);
+	EXPECT_EQ(Reused & 0xFFFFFFFF, 1u);
+	EXPECT_EQ(Ids.find(Reused), 7u);
+	EXPECT_EQ(Ids.find(1), SlotMap::Invalid);
+
+	Ids.move(3, 1);
+	EXPECT_EQ(Ids.find(3), 1u);
+	EXPECT_EQ(Ids.find(100), SlotMap::Invalid);
+}
+
+TEST(SlotMap, denseArray)
+{
+	using namespace PositionGenerator;
+	// a dense array that fills gaps with its last entry, as the generator does with its sensors
+	SlotMap Ids;
+	std::vector<SlotMap::id_t> Dense;
+	std::unordered_map<SlotMap::id_t, int> Alive;
+	std::mt19937 Gen(9);
+	for (int step = 0; step < 20000; ++step)
+	{
+		if (Dense.empty() || Gen() % 3 != 0)
+		{
+			auto Id = Ids.insert(static_cast<SlotMap::index_t>(Dense.size()));
+			ASSERT_EQ(Alive.count(Id), 0u);
+			Dense.push_back(Id);
+			Alive[Id] = step;
+		}
+		else
+		{
+			const std::size_t index = Gen() % Dense.size();
+			const SlotMap::id_t Id = Dense[index];
+			ASSERT_TRUE(Ids.erase(Id));
+			if (index + 1 != Dense.size())
+			{
+				Dense[index] = Dense.back();
+				Ids.move(Dense[index], static_cast<SlotMap::index_t>(index));
+			}
+			Dense.pop_back();
+			Alive.erase(Id);
+		}
+	}
+	ASSERT_EQ(Ids.size(), Dense.size());
+	for (std::size_t i = 0; i < Dense.size(); ++i)
+		EXPECT_EQ(Ids.find(Dense[i]), i);
+}
@@ -0,0 +1,140 @@
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "SpatialGrid.h"
+
+namespace
+{
+	struct Positions
+	{
+		std::vector<float> x, y, z;
+
+		Positions(std::size_t count, uint32_t seed)
+		{
+			std::mt19937 Gen(seed);
+			std::uniform_real_distribution<float> Plane(0.f, 20.f), Height(0.5f, 1.5f);
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				x.push_back(Plane(Gen));
+				y.push_back(Plane(Gen));
+				z.push_back(Height(Gen));
+			}
+		}
+
+		float squaredDistance(std::size_t i, std::size_t j) const
+		{
+			const float dx = x[i] - x[j], dy = y[i] - y[j], dz = z[i] - z[j];
+			return dx * dx + dy * dy + dz * dz;
+		}
+
+		std::set<std::pair<uint32_t, uint32_t>> bruteForcePairs(float radius) const
+		{
+			std::set<std::pair<uint32_t, uint32_t>> Pairs;
+			for (uint32_t i = 0; i < x.size(); ++i)
+				for (uint32_t j = i + 1; j < x.size(); ++j)
+					if (squaredDistance(i, j) <= radius * radius)
+						Pairs.insert({ i, j });
+			return Pairs;
+		}
+	};
+
+	std::set<std::pair<uint32_t, uint32_t>> gridPairs(const PositionGenerator::SpatialGrid& Grid, float radius)
+	{
+		std::set<std::pair<uint32_t, uint32_t>> Pairs;
+		Grid.forEachPair(radius, [&](uint32_t first, uint32_t second, float)
+			{
+				// every pair only once
+				EXPECT_TRUE(Pairs.insert(std::minmax(first, second)).second);
+			});
+		return Pairs;
+	}
+}
+
+TEST(SpatialGrid, layout)
+{
+	using namespace PositionGenerator;
+	SpatialGrid Grid(Vector3(0.f, 0.f, 0.5f), Vector3(100.f, 50.f, 1.5f), 2.f);
+	EXPECT_EQ(Grid.dims()[0], 50u);
+	EXPECT_EQ(Grid.dims()[1], 25u);
+	EXPECT_EQ(Grid.dims()[2], 1u);
+	EXPECT_EQ(Grid.numCells(), 1250u);
+
+	EXPECT_THROW(SpatialGrid(Vector3(0.f, 0.f, 0.f), Vector3(1.f, 1.f, 1.f), 0.f), std::invalid_argument);
+	EXPECT_THROW(SpatialGrid(Vector3(0.f, 0.f, 0.f), Vector3(1.E6f, 1.E6f, 1.E6f), 1.E-3f), std::invalid_argument);
+}
+
+TEST(SpatialGrid, rangeQuery)
+{
+	using namespace PositionGenerator;
+	Positions Pos(2000, 1);
+	SpatialGrid Grid(Vector3(0.f, 0.f, 0.5f), Vector3(20.f, 20.f, 1.5f), 1.f);
+	Grid.build(Pos.x.size(), Pos.x.data(), Pos.y.data(), Pos.z.data());
+	EXPECT_EQ(Grid.size(), Pos.x.size());
+
+	// centers inside, on the border and outside of the cuboid, radius below and above the cell size
+	for (const auto& Center : { Vector3(10.f, 10.f, 1.f), Vector3(0.f, 20.f, 0.5f), Vector3(-1.f, 5.f, 1.f) })
+	{
+		for (float radius : { 0.4f, 1.f, 2.5f })
+		{
+			std::set<uint32_t> Expected;
+			for (uint32_t i = 0; i < Pos.x.size(); ++i)
+			{
+				const float dx = Pos.x[i] - Center.x(), dy = Pos.y[i] - Center.y(), dz = Pos.z[i] - Center.z();
+				if (dx * dx + dy * dy + dz * dz <= radius * radius)
+					Expected.insert(i);
+			}
+			std::set<uint32_t> Found;
+			Grid.forEachInRange(Center, radius, [&](uint32_t index, float) { Found.insert(index); });
+			EXPECT_EQ(Found, Expected);
+		}
+	}
+}
+
+TEST(SpatialGrid, pairsMatchBruteForce)
+{
+	using namespace PositionGenerator;
+	Positions Pos(1500, 2);
+	SpatialGrid Grid(Vector3(0.f, 0.f, 0.5f), Vector3(20.f, 20.f, 1.5f), 0.5f);
+	Grid.build(Pos.x.size(), Pos.x.data(), Pos.y.data(), Pos.z.data());
+
+	// a radius larger than the cell size has to look further than the direct neighbours
+	for (float radius : { 0.3f, 0.5f, 1.2f })
+		EXPECT_EQ(gridPairs(Grid, radius), Pos.bruteForcePairs(radius));
+}
+
+TEST(SpatialGrid, incrementalUpdate)
+{
+	using namespace PositionGenerator;
+	Positions Pos(1000, 3);
+	SpatialGrid Grid(Vector3(0.f, 0.f, 0.5f), Vector3(20.f, 20.f, 1.5f), 1.f);
+	Grid.build(Pos.x.size(), Pos.x.data(), Pos.y.data(), Pos.z.data());
+	EXPECT_EQ(Grid.update(), 0u);
+
+	// small steps, only some positions leave their cell
+	std::mt19937 Gen(4);
+	std::uniform_real_distribution<float> Step(-0.3f, 0.3f);
+	for (int tick = 0; tick < 20; ++tick)
+	{
+		for (std::size_t i = 0; i < Pos.x.size(); ++i)
+		{
+			Pos.x[i] = std::clamp(Pos.x[i] + Step(Gen), 0.f, 20.f);
+			Pos.y[i] = std::clamp(Pos.y[i] + Step(Gen), 0.f, 20.f);
+		}
+		auto moved = Grid.update();
+		EXPECT_GT(moved, 0u);
+		EXPECT_LT(moved, Pos.x.size() / 2);
+	}
+
+	// the relinked grid answers like a fresh one
+	SpatialGrid Fresh(Vector3(0.f, 0.f, 0.5f), Vector3(20.f, 20.f, 1.5f), 1.f);
+	Fresh.build(Pos.x.size(), Pos.x.data(), Pos.y.data(), Pos.z.data());
+	for (uint32_t i = 0; i < Pos.x.size(); ++i)
+		EXPECT_EQ(Grid.cellOf(i), Fresh.cellOf(i));
+	EXPECT_EQ(gridPairs(Grid, 0.8f), Pos.bruteForcePairs(0.8f));
+}
@@ -0,0 +1,72 @@
+#include <cstdint>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "SpscRing.h"
+
+TEST(SpscRing, pushPopOrder)
+{
+	using namespace PositionGenerator;
+	SpscRing<int> Ring(3);
+	EXPECT_EQ(Ring.capacity(), 4);
+	EXPECT_TRUE(Ring.empty());
+
+	for (int i = 0; i < 4; ++i)
+		EXPECT_TRUE(Ring.tryPush(i));
+	// full
+	EXPECT_FALSE(Ring.tryPush(4));
+
+	int Value = -1;
+	for (int i = 0; i < 4; ++i)
+	{
+		EXPECT_TRUE(Ring.tryPop(Value));
+		EXPECT_EQ(Value, i);
+	}
+	EXPECT_FALSE(Ring.tryPop(Value));
+	EXPECT_TRUE(Ring.empty());
+}
+
+TEST(SpscRing, wrapAround)
+{
+	using namespace PositionGenerator;
+	SpscRing<int> Ring(2);
+	int Value = 0;
+	for (int i = 0; i < 100; ++i)
+	{
+		EXPECT_TRUE(Ring.tryPush(i));
+		EXPECT_TRUE(Ring.tryPop(Value));
+		EXPECT_EQ(Value, i);
+	}
+}
+
+TEST(SpscRing, twoThreads)
+{
+	using namespace PositionGenerator;
+	constexpr uint64_t Count = 200000;
+	SpscRing<uint64_t> Ring(64);
+
+	std::thread Producer([&Ring]()
+		{
+			for (uint64_t i = 0; i < Count; ++i)
+			{
+				while (!Ring.tryPush(i))
+					std::this_thread::yield();
+			}
+		});
+
+	uint64_t expected = 0;
+	uint64_t Value = 0;
+	while (expected < Count)
+	{
+		if (!Ring.tryPop(Value))
+		{
+			std::this_thread::yield();
+			continue;
+		}
+		ASSERT_EQ(Value, expected);
+		++expected;
+	}
+	Producer.join();
+	EXPECT_TRUE(Ring.empty());
+}
@@ -0,0 +1,130 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "Generator.h"
+#include "TickLog.h"
+
+namespace
+{
+	std::string tempFile(const char* name)
+	{
+		return (std::filesystem::temp_directory_path() / name).string();
+	}
+}
+
+TEST(TickLog, saveAndLoad)
+{
+	using namespace PositionGenerator;
+	RunParameter Run;
+	Run.numOfSensors = 1234;
+	Run.randomPolicy = 1;
+	Run.minValues = { -1.f, -2.f, 0.5f };
+	Run.maxValues = { 100.f, 50.f, 1.5f };
+	Run.maxVelocity = 12.f;
+	Run.noiseDimension = 0.3f;
+	Run.updateRates = { 10., 10., 200. };
+	TickLog Log(0xFEDCBA9876543210ull, 1000, 1000000, Run);
+	for (timestamp_t t = 1; t <= 1000; ++t)
+		Log.append(1000 + t * 40000 + (t % 3)); // slightly irregular like wall clock ticks
+
+	auto fileName = tempFile("posgen_ticklog_test.bin");
+	Log.save(fileName);
+	auto Loaded = TickLog::load(fileName);
+	std::remove(fileName.c_str());
+
+	EXPECT_EQ(Loaded.seed(), Log.seed());
+	EXPECT_EQ(Loaded.initialTimestamp(), Log.initialTimestamp());
+	EXPECT_EQ(Loaded.timestampUnitsPerSecond(), Log.timestampUnitsPerSecond());
+	EXPECT_EQ(Loaded.runParameter(), Run);
+	EXPECT_EQ(Loaded.timestamps(), Log.timestamps());
+}
+
+TEST(TickLog, loadRejectsOtherFiles)
+{
+	using namespace PositionGenerator;
+	EXPECT_THROW(TickLog::load(tempFile("posgen_ticklog_does_not_exist.bin")), std::runtime_error);
+
+	auto fileName = tempFile("posgen_ticklog_garbage.bin");
+	{
+		std::ofstream Out(fileName, std::ios::binary);
+		Out << "definitely not a tick log";
+	}
+	EXPECT_THROW(TickLog::load(fileName), std::runtime_error);
+	std::remove(fileName.c_str());
+}
+
+TEST(TickLog, replayReproducesRun)
+{
+	using namespace PositionGenerator;
+
+	for (auto policy : { RandomPolicy::MersenneTwister, RandomPolicy::CounterBased })
+	{
+		auto Param = GenerationParameter()
+			.setNumOfSensors(1000)
+			.setRandomPolicy(policy);
+
+		// recorded run on one thread with a seed from random_device
+		Generator Recorded(Param);
+		TickLog Log = Recorded.emptyTickLog();
+		for (timestamp_t t = 1; t <= 50; ++t)
+		{
+			Log.append(t * 40000 + (t % 5) * 7);
+			Recorded.generateData(Log.timestamps().back());
+		}
+
+		// replay on several threads
+		ReplayGenerator Replay(GenerationParameter(Param).setNumOfThreads(4).setShardSize(64), Log);
+		std::size_t numTicks = 0;
+		while (Replay.generateData())
+			++numTicks;
+		EXPECT_EQ(numTicks, Log.size());
+		EXPECT_TRUE(Replay.finished());
+		EXPECT_EQ(Replay.currentTimestamp(), Recorded.currentTimestamp());
+
+		ASSERT_EQ(Replay.sensors().size(), Recorded.sensors().size());
+		for (std::size_t i = 0; i < Recorded.sensors().size(); ++i)
+		{
+			auto Expected = Recorded.sensors().at(i);
+			auto Actual = Replay.sensors().at(i);
+			EXPECT_EQ(Actual.timestamp(), Expected.timestamp());
+			EXPECT_EQ(Actual.position().x(), Expected.position().x());
+			EXPECT_EQ(Actual.position().y(), Expected.position().y());
+			EXPECT_EQ(Actual.position().z(), Expected.position().z());
+			EXPECT_EQ(Actual.velocity().x(), Expected.velocity().x());
+			EXPECT_EQ(Actual.velocity().y(), Expected.velocity().y());
+		}
+	}
+}
+
+TEST(TickLog, replayRejectsOtherParameters)
+{
+	using namespace PositionGenerator;
+	auto Param = GenerationParameter()
+		.setNumOfSensors(100)
+		.setUpdateRates({ 10., 50. });
+	TickLog Log = Generator(Param).emptyTickLog();
+	Log.append(40000);
+
+	// same data with another thread count, shard size and spatial index
+	EXPECT_NO_THROW(ReplayGenerator(GenerationParameter(Param).setNumOfThreads(2).setShardSize(32).setGridCellSize(5.f), Log));
+
+	EXPECT_THROW(ReplayGenerator(GenerationParameter(Param).setNumOfSensors(101), Log), std::invalid_argument);
+	EXPECT_THROW(ReplayGenerator(GenerationParameter(Param).setRandomPolicy(RandomPolicy::CounterBased), Log), std::invalid_argument);
+	EXPECT_THROW(ReplayGenerator(GenerationParameter(Param).setBoundingCuboid(Vector3(0.f, 0.f, 0.f), Vector3(10.f, 10.f, 2.f)), Log), std::invalid_argument);
+	EXPECT_THROW(ReplayGenerator(GenerationParameter(Param).setMaximalVelocity(5.f), Log), std::invalid_argument);
+	EXPECT_THROW(ReplayGenerator(GenerationParameter(Param).setNoiseDimension(0.f), Log), std::invalid_argument);
+	EXPECT_THROW(ReplayGenerator(GenerationParameter(Param).setUpdateRates({ 10. }), Log), std::invalid_argument);
+
+	// the check also holds after a round trip through the file
+	auto fileName = tempFile("posgen_ticklog_params.bin");
+	Log.save(fileName);
+	auto Loaded = TickLog::load(fileName);
+	std::remove(fileName.c_str());
+	EXPECT_NO_THROW(ReplayGenerator(Param, Loaded));
+	EXPECT_THROW(ReplayGenerator(GenerationParameter(Param).setNumOfSensors(99), Loaded), std::invalid_argument);
+}
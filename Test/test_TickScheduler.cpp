@@ -0,0 +1,63 @@
+#include <chrono>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "TickScheduler.h"
+
+TEST(TickScheduler, noDrift)
+{
+	using namespace PositionGenerator;
+	using namespace std::chrono;
+	constexpr int numTicks = 50;
+
+	// 2 kHz is not possible with whole millisecond sleeps
+	auto start = TickScheduler::Clock_t::now();
+	TickScheduler Scheduler(2000., microseconds(200));
+	EXPECT_EQ(Scheduler.period(), microseconds(500));
+
+	for (int i = 1; i <= numTicks; ++i)
+	{
+		// some work that is part of the period
+		std::this_thread::sleep_for(microseconds(100));
+		auto Tick = Scheduler.waitForNextTick();
+		EXPECT_GE(TickScheduler::Clock_t::now() - start, microseconds(500) * static_cast<int>(Tick.tick));
+	}
+	// work plus sleep must not add up, allow for a loaded test machine
+	auto elapsed = TickScheduler::Clock_t::now() - start;
+	EXPECT_GE(elapsed, microseconds(500 * numTicks));
+	EXPECT_LT(elapsed, microseconds(500 * numTicks) + milliseconds(20));
+}
+
+TEST(TickScheduler, overrunDetection)
+{
+	using namespace PositionGenerator;
+	using namespace std::chrono;
+
+	TickScheduler Scheduler(1000.);
+	auto First = Scheduler.waitForNextTick();
+	EXPECT_EQ(First.missedTicks, 0);
+
+	// a tick that takes ten periods
+	std::this_thread::sleep_for(milliseconds(10));
+	auto Late = Scheduler.waitForNextTick();
+	EXPECT_GE(Late.missedTicks, 8);
+	EXPECT_EQ(Late.slack, TickScheduler::Clock_t::duration::zero());
+	EXPECT_EQ(Scheduler.totalMissedTicks(), Late.missedTicks);
+
+	// the schedule continues from the latest deadline instead of catching up
+	auto Next = Scheduler.waitForNextTick();
+	EXPECT_EQ(Next.tick, Late.tick + 1);
+	EXPECT_EQ(Next.missedTicks, 0);
+}
+
+TEST(TickScheduler, invalidFrequency)
+{
+	using namespace PositionGenerator;
+	EXPECT_THROW(TickScheduler{ 0. }, std::invalid_argument);
+	EXPECT_THROW(TickScheduler{ -25. }, std::invalid_argument);
+	EXPECT_THROW(TickScheduler{ std::numeric_limits<double>::quiet_NaN() }, std::invalid_argument);
+	EXPECT_THROW(TickScheduler{ std::numeric_limits<double>::infinity() }, std::invalid_argument);
+}
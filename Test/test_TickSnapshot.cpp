@@ -0,0 +1,51 @@
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "Generator.h"
+#include "TickSnapshot.h"
+
+TEST(TickSnapshot, splitBySensorId)
+{
+	using namespace PositionGenerator;
+	Generator Gen(GenerationParameter().setNumOfSensors(1001).setRandomPolicy(RandomPolicy::CounterBased));
+	Gen.generateData(40000);
+	TickSnapshot Snapshot;
+	Gen.captureSnapshot(Snapshot);
+
+	std::vector<TickSnapshot> Shards(4);
+	std::vector<TickSnapshot*> pShards;
+	for (auto& Shard : Shards)
+		pShards.push_back(&Shard);
+	std::vector<std::size_t> Counts;
+	// the second split reuses the shards of the first one
+	for (int round = 0; round < 2; ++round)
+	{
+		splitSnapshot(Snapshot, pShards, Counts);
+
+		std::size_t total = 0;
+		for (std::size_t shard = 0; shard < Shards.size(); ++shard)
+		{
+			const TickSnapshot& Shard = Shards[shard];
+			EXPECT_EQ(Shard.tickTimestamp, Snapshot.tickTimestamp);
+			for (std::size_t i = 0; i < Shard.size(); ++i)
+			{
+				// ids are the indices of the generator's sensors
+				const std::size_t index = Shard.sensorIds[i];
+				EXPECT_EQ(shardOf(Shard.sensorIds[i], Shards.size()), shard);
+				if (i > 0)
+				{
+					EXPECT_LT(Shard.sensorIds[i - 1], Shard.sensorIds[i]);
+				}
+				EXPECT_EQ(Shard.timestamps[i], Snapshot.timestamps[index]);
+				EXPECT_EQ(Shard.x[i], Snapshot.x[index]);
+				EXPECT_EQ(Shard.y[i], Snapshot.y[index]);
+				EXPECT_EQ(Shard.z[i], Snapshot.z[index]);
+			}
+			total += Shard.size();
+		}
+		EXPECT_EQ(total, Snapshot.size());
+		EXPECT_EQ(Shards[0].size(), 251u);
+		EXPECT_EQ(Shards[3].size(), 250u);
+	}
+}
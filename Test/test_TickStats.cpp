@@ -0,0 +1,75 @@
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "TickStats.h"
+
+TEST(TickStats, bucketsKeepPrecision)
+{
+	using namespace PositionGenerator;
+	for (uint64_t value : { 0ull, 1ull, 31ull, 32ull, 33ull, 1000ull, 123456ull, 987654321ull, (1ull << 39) + 12345 })
+	{
+		const auto bucket = LatencyHistogram::bucketOf(value);
+		ASSERT_LT(bucket, LatencyHistogram::NumBuckets);
+		const uint64_t upper = LatencyHistogram::bucketUpperBound(bucket);
+		EXPECT_GE(upper, value);
+		EXPECT_LE(upper - value, value / LatencyHistogram::SubBuckets);
+		if (bucket > 0)
+		{
+			EXPECT_LT(LatencyHistogram::bucketUpperBound(bucket - 1), value);
+		}
+	}
+	EXPECT_EQ(LatencyHistogram::bucketOf(~0ull), LatencyHistogram::NumBuckets - 1);
+}
+
+TEST(TickStats, percentiles)
+{
+	using namespace PositionGenerator;
+	LatencyHistogram Histogram;
+	// 1..10000us, recorded from several threads
+	std::vector<std::thread> Threads;
+	for (uint64_t t = 0; t < 4; ++t)
+		Threads.emplace_back([&Histogram, t]()
+			{
+				for (uint64_t us = 1 + t; us <= 10000; us += 4)
+					Histogram.record(us * 1000);
+			});
+	for (auto& Thread : Threads)
+		Thread.join();
+
+	LatencyDistribution Distribution;
+	Histogram.collect(Distribution);
+	EXPECT_EQ(Distribution.count(), 10000u);
+	EXPECT_NEAR(static_cast<double>(Distribution.percentile(0.5)), 5.E6, 5.E6 / 32);
+	EXPECT_NEAR(static_cast<double>(Distribution.percentile(0.99)), 9.9E6, 9.9E6 / 32);
+	EXPECT_NEAR(static_cast<double>(Distribution.percentile(0.999)), 9.99E6, 9.99E6 / 32);
+	EXPECT_GE(Distribution.max(), 10000000u);
+
+	// collect starts a new interval
+	Histogram.collect(Distribution);
+	EXPECT_EQ(Distribution.count(), 0u);
+	EXPECT_EQ(Distribution.percentile(0.5), 0u);
+}
+
+TEST(TickStats, report)
+{
+	using namespace PositionGenerator;
+	TickStats Stats;
+	{
+		StageTimer Timer(&Stats, TickStage::Generate);
+	}
+	Stats.record(TickStage::Send, std::chrono::microseconds(20));
+	Stats.countTick();
+	Stats.countMessages(1000, 24000);
+	StageTimer Disabled(nullptr, TickStage::Noise);
+
+	std::ostringstream Out;
+	Stats.report(Out);
+	const std::string Line = Out.str();
+	EXPECT_NE(Line.find("generate p50"), std::string::npos);
+	EXPECT_NE(Line.find("send p50 20"), std::string::npos);
+	EXPECT_EQ(Line.find("noise"), std::string::npos);
+	EXPECT_NE(Line.find("msg/s"), std::string::npos);
+}
@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "UpdateWheel.h"
+
+TEST(UpdateWheel, popDue)
+{
+	using namespace PositionGenerator;
+	UpdateWheel Wheel(1000, 10, 8);
+	EXPECT_EQ(Wheel.numSlots(), 8u);
+	EXPECT_EQ(Wheel.slotWidth(), 8u);
+	Wheel.resize(4);
+	EXPECT_FALSE(Wheel.scheduled(0));
+	Wheel.schedule(0, 1005);
+	Wheel.schedule(1, 1025);
+	Wheel.schedule(2, 1029);
+	// more than one turn of the wheel ahead
+	Wheel.schedule(3, 1205);
+
+	std::vector<UpdateWheel::index_t> Due;
+	EXPECT_EQ(Wheel.popDue(1004, Due), 0u);
+	EXPECT_EQ(Wheel.popDue(1026, Due), 2u);
+	std::sort(Due.begin(), Due.end());
+	EXPECT_EQ(Due, (std::vector<UpdateWheel::index_t>{ 0, 1 }));
+	EXPECT_FALSE(Wheel.scheduled(0));
+	EXPECT_TRUE(Wheel.scheduled(2));
+
+	// 3 is skipped until its turn of the wheel comes
+	Due.clear();
+	EXPECT_EQ(Wheel.popDue(1100, Due), 1u);
+	EXPECT_EQ(Due.front(), 2u);
+	Due.clear();
+	EXPECT_EQ(Wheel.popDue(1210, Due), 1u);
+	EXPECT_EQ(Due.front(), 3u);
+
+	// scheduled in the past, due on the next call
+	Wheel.schedule(1, 900);
+	Wheel.schedule(2, 1300);
+	Wheel.cancel(2);
+	Due.clear();
+	EXPECT_EQ(Wheel.popDue(1210, Due), 1u);
+	EXPECT_EQ(Due.front(), 1u);
+	EXPECT_EQ(Wheel.popDue(5000, Due), 0u);
+
+	EXPECT_THROW(UpdateWheel(0, 0, 8), std::invalid_argument);
+}
+
+TEST(UpdateWheel, matchesBruteForce)
+{
+	using namespace PositionGenerator;
+	constexpr std::size_t count = 2000;
+	std::mt19937 Gen(5);
+	std::uniform_int_distribution<timestamp_t> Period(1, 500), Step(0, 60), Jump(0, 3000);
+
+	UpdateWheel Wheel(0, 16, 32);
+	Wheel.resize(count);
+	std::vector<timestamp_t> Expected(count);
+	for (UpdateWheel::index_t i = 0; i < count; ++i)
+	{
+		Expected[i] = Period(Gen);
+		Wheel.schedule(i, Expected[i]);
+	}
+
+	timestamp_t now = 0;
+	std::vector<UpdateWheel::index_t> Due;
+	for (int tick = 0; tick < 500; ++tick)
+	{
+		// mostly small steps, every now and then more than a turn of the wheel
+		now += tick % 50 == 0 ? Jump(Gen) : Step(Gen);
+		Due.clear();
+		Wheel.popDue(now, Due);
+		std::sort(Due.begin(), Due.end());
+
+		std::vector<UpdateWheel::index_t> BruteForce;
+		for (UpdateWheel::index_t i = 0; i < count; ++i)
+			if (Expected[i] <= now)
+				BruteForce.push_back(i);
+		ASSERT_EQ(Due, BruteForce) << "tick " << tick;
+
+		for (auto i : Due)
+		{
+			Expected[i] = now + Period(Gen);
+			Wheel.schedule(i, Expected[i]);
+		}
+	}
+}
@@ -0,0 +1,48 @@
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "WorkerPool.h"
+
+TEST(WorkerPool, everyShardOnce)
+{
+	using namespace PositionGenerator;
+	WorkerPool Pool(4);
+	EXPECT_EQ(Pool.numThreads(), 4);
+
+	constexpr std::size_t numShards = 1000;
+	std::vector<std::atomic<int>> Calls(numShards);
+	for (int round = 0; round < 10; ++round)
+	{
+		Pool.run(numShards, [&](std::size_t shard)
+			{
+				// uneven cost, the first shards are much more expensive
+				if (shard < 8)
+					std::this_thread::sleep_for(std::chrono::milliseconds(2));
+				++Calls[shard];
+			});
+	}
+	for (const auto& Count : Calls)
+		EXPECT_EQ(Count, 10);
+}
+
+TEST(WorkerPool, exceptionIsForwarded)
+{
+	using namespace PositionGenerator;
+	WorkerPool Pool(3);
+	std::atomic<int> Executed = 0;
+	EXPECT_THROW(Pool.run(100, [&](std::size_t shard)
+		{
+			++Executed;
+			if (shard == 42)
+				throw std::runtime_error("shard failed");
+		}), std::runtime_error);
+	// all other shards still got executed and the pool stays usable
+	EXPECT_EQ(Executed, 100);
+	Pool.run(10, [&](std::size_t) { ++Executed; });
+	EXPECT_EQ(Executed, 110);
+}
@@ -53,8 +53,53 @@ struct GeneratedPositionDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GeneratedPositionDefaultTypeInternal _GeneratedPosition_default_instance_;
+PROTOBUF_CONSTEXPR GeneratedPositionBatch::GeneratedPositionBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.sensorid_)*/{}
+  , /*decltype(_impl_._sensorid_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.timestamp_usec_)*/{}
+  , /*decltype(_impl_._timestamp_usec_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.x_)*/{}
+  , /*decltype(_impl_.y_)*/{}
+  , /*decltype(_impl_.z_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GeneratedPositionBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GeneratedPositionBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GeneratedPositionBatchDefaultTypeInternal() {}
+  union {
+    GeneratedPositionBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GeneratedPositionBatchDefaultTypeInternal _GeneratedPositionBatch_default_instance_;
+PROTOBUF_CONSTEXPR GeneratedPositionDelta::GeneratedPositionDelta(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.sensorid_delta_)*/{}
+  , /*decltype(_impl_._sensorid_delta_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.timestamp_offset_)*/{}
+  , /*decltype(_impl_._timestamp_offset_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.x_)*/{}
+  , /*decltype(_impl_._x_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.y_)*/{}
+  , /*decltype(_impl_._y_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.z_)*/{}
+  , /*decltype(_impl_._z_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.keyframe_)*/false
+  , /*decltype(_impl_.resolution_)*/0
+  , /*decltype(_impl_.timestamp_usec_)*/uint64_t{0u}} {}
+struct GeneratedPositionDeltaDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GeneratedPositionDeltaDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GeneratedPositionDeltaDefaultTypeInternal() {}
+  union {
+    GeneratedPositionDelta _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GeneratedPositionDeltaDefaultTypeInternal _GeneratedPositionDelta_default_instance_;
 }  // namespace PositionGenerator
-static ::_pb::Metadata file_level_metadata_SensorPosition_2eproto[2];
+static ::_pb::Metadata file_level_metadata_SensorPosition_2eproto[4];
 static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_SensorPosition_2eproto = nullptr;
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_SensorPosition_2eproto = nullptr;
 
@@ -83,15 +128,52 @@ const uint32_t TableStruct_SensorPosition_2eproto::offsets[] PROTOBUF_SECTION_VA
   1,
   2,
   0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::PositionGenerator::GeneratedPositionBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::PositionGenerator::GeneratedPositionBatch, _impl_.sensorid_),
+  PROTOBUF_FIELD_OFFSET(::PositionGenerator::GeneratedPositionBatch, _impl_.timestamp_usec_),
+  PROTOBUF_FIELD_OFFSET(::PositionGenerator::GeneratedPositionBatch, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::PositionGenerator::GeneratedPositionBatch, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::PositionGenerator::GeneratedPositionBatch, _impl_.z_),
+  PROTOBUF_FIELD_OFFSET(::PositionGenerator::GeneratedPositionDelta, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::PositionGenerator::GeneratedPositionDelta, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::PositionGenerator::GeneratedPositionDelta, _impl_.keyframe_),
+  PROTOBUF_FIELD_OFFSET(::PositionGenerator::GeneratedPositionDelta, _impl_.resolution_),
+  PROTOBUF_FIELD_OFFSET(::PositionGenerator::GeneratedPositionDelta, _impl_.timestamp_usec_),
+  PROTOBUF_FIELD_OFFSET(::PositionGenerator::GeneratedPositionDelta, _impl_.sensorid_delta_),
+  PROTOBUF_FIELD_OFFSET(::PositionGenerator::GeneratedPositionDelta, _impl_.timestamp_offset_),
+  PROTOBUF_FIELD_OFFSET(::PositionGenerator::GeneratedPositionDelta, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::PositionGenerator::GeneratedPositionDelta, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::PositionGenerator::GeneratedPositionDelta, _impl_.z_),
+  0,
+  1,
+  2,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, 9, -1, sizeof(::PositionGenerator::Data3d)},
   { 12, 21, -1, sizeof(::PositionGenerator::GeneratedPosition)},
+  { 24, -1, -1, sizeof(::PositionGenerator::GeneratedPositionBatch)},
+  { 35, 49, -1, sizeof(::PositionGenerator::GeneratedPositionDelta)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
   &::PositionGenerator::_Data3d_default_instance_._instance,
   &::PositionGenerator::_GeneratedPosition_default_instance_._instance,
+  &::PositionGenerator::_GeneratedPositionBatch_default_instance_._instance,
+  &::PositionGenerator::_GeneratedPositionDelta_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_SensorPosition_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -99,13 +181,21 @@ const char descriptor_table_protodef_SensorPosition_2eproto[] PROTOBUF_SECTION_V
   "r\")\n\006Data3d\022\t\n\001x\030\001 \002(\002\022\t\n\001y\030\002 \002(\002\022\t\n\001z\030\003"
   " \002(\002\"j\n\021GeneratedPosition\022\020\n\010sensorId\030\001 "
   "\002(\004\022\026\n\016timestamp_usec\030\002 \002(\004\022+\n\010position\030"
-  "\003 \002(\0132\031.PositionGenerator.Data3d"
+  "\003 \002(\0132\031.PositionGenerator.Data3d\"w\n\026Gene"
+  "ratedPositionBatch\022\024\n\010sensorId\030\001 \003(\004B\002\020\001"
+  "\022\032\n\016timestamp_usec\030\002 \003(\004B\002\020\001\022\r\n\001x\030\003 \003(\002B"
+  "\002\020\001\022\r\n\001y\030\004 \003(\002B\002\020\001\022\r\n\001z\030\005 \003(\002B\002\020\001\"\275\001\n\026Ge"
+  "neratedPositionDelta\022\020\n\010keyframe\030\001 \002(\010\022\022"
+  "\n\nresolution\030\002 \002(\002\022\026\n\016timestamp_usec\030\003 \002"
+  "(\004\022\032\n\016sensorId_delta\030\004 \003(\022B\002\020\001\022\034\n\020timest"
+  "amp_offset\030\005 \003(\022B\002\020\001\022\r\n\001x\030\006 \003(\021B\002\020\001\022\r\n\001y"
+  "\030\007 \003(\021B\002\020\001\022\r\n\001z\030\010 \003(\021B\002\020\001"
   ;
 static ::_pbi::once_flag descriptor_table_SensorPosition_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_SensorPosition_2eproto = {
-    false, false, 192, descriptor_table_protodef_SensorPosition_2eproto,
+    false, false, 505, descriptor_table_protodef_SensorPosition_2eproto,
     "SensorPosition.proto",
-    &descriptor_table_SensorPosition_2eproto_once, nullptr, 0, 2,
+    &descriptor_table_SensorPosition_2eproto_once, nullptr, 0, 4,
     schemas, file_default_instances, TableStruct_SensorPosition_2eproto::offsets,
     file_level_metadata_SensorPosition_2eproto, file_level_enum_descriptors_SensorPosition_2eproto,
     file_level_service_descriptors_SensorPosition_2eproto,
@@ -709,6 +799,835 @@ void GeneratedPosition::InternalSwap(GeneratedPosition* other) {
       file_level_metadata_SensorPosition_2eproto[1]);
 }
 
+// ===================================================================
+
+class GeneratedPositionBatch::_Internal {
+ public:
+};
+
+GeneratedPositionBatch::GeneratedPositionBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:PositionGenerator.GeneratedPositionBatch)
+}
+GeneratedPositionBatch::GeneratedPositionBatch(const GeneratedPositionBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GeneratedPositionBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sensorid_){from._impl_.sensorid_}
+    , /*decltype(_impl_._sensorid_cached_byte_size_)*/{0}
+    , decltype(_impl_.timestamp_usec_){from._impl_.timestamp_usec_}
+    , /*decltype(_impl_._timestamp_usec_cached_byte_size_)*/{0}
+    , decltype(_impl_.x_){from._impl_.x_}
+    , decltype(_impl_.y_){from._impl_.y_}
+    , decltype(_impl_.z_){from._impl_.z_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:PositionGenerator.GeneratedPositionBatch)
+}
+
+inline void GeneratedPositionBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sensorid_){arena}
+    , /*decltype(_impl_._sensorid_cached_byte_size_)*/{0}
+    , decltype(_impl_.timestamp_usec_){arena}
+    , /*decltype(_impl_._timestamp_usec_cached_byte_size_)*/{0}
+    , decltype(_impl_.x_){arena}
+    , decltype(_impl_.y_){arena}
+    , decltype(_impl_.z_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+GeneratedPositionBatch::~GeneratedPositionBatch() {
+  // @@protoc_insertion_point(destructor:PositionGenerator.GeneratedPositionBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GeneratedPositionBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.sensorid_.~RepeatedField();
+  _impl_.timestamp_usec_.~RepeatedField();
+  _impl_.x_.~RepeatedField();
+  _impl_.y_.~RepeatedField();
+  _impl_.z_.~RepeatedField();
+}
+
+void GeneratedPositionBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GeneratedPositionBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:PositionGenerator.GeneratedPositionBatch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.sensorid_.Clear();
+  _impl_.timestamp_usec_.Clear();
+  _impl_.x_.Clear();
+  _impl_.y_.Clear();
+  _impl_.z_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GeneratedPositionBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint64 sensorId = 1 [packed = true];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_sensorid(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_sensorid(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 timestamp_usec = 2 [packed = true];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_timestamp_usec(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_timestamp_usec(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float x = 3 [packed = true];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_x(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 29) {
+          _internal_add_x(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float y = 4 [packed = true];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_y(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 37) {
+          _internal_add_y(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float z = 5 [packed = true];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_z(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 45) {
+          _internal_add_z(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GeneratedPositionBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:PositionGenerator.GeneratedPositionBatch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint64 sensorId = 1 [packed = true];
+  {
+    int byte_size = _impl_._sensorid_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          1, _internal_sensorid(), byte_size, target);
+    }
+  }
+
+  // repeated uint64 timestamp_usec = 2 [packed = true];
+  {
+    int byte_size = _impl_._timestamp_usec_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          2, _internal_timestamp_usec(), byte_size, target);
+    }
+  }
+
+  // repeated float x = 3 [packed = true];
+  if (this->_internal_x_size() > 0) {
+    target = stream->WriteFixedPacked(3, _internal_x(), target);
+  }
+
+  // repeated float y = 4 [packed = true];
+  if (this->_internal_y_size() > 0) {
+    target = stream->WriteFixedPacked(4, _internal_y(), target);
+  }
+
+  // repeated float z = 5 [packed = true];
+  if (this->_internal_z_size() > 0) {
+    target = stream->WriteFixedPacked(5, _internal_z(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:PositionGenerator.GeneratedPositionBatch)
+  return target;
+}
+
+size_t GeneratedPositionBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:PositionGenerator.GeneratedPositionBatch)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint64 sensorId = 1 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.sensorid_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._sensorid_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint64 timestamp_usec = 2 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.timestamp_usec_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._timestamp_usec_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated float x = 3 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_x_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated float y = 4 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_y_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated float z = 5 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_z_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GeneratedPositionBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GeneratedPositionBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GeneratedPositionBatch::GetClassData() const { return &_class_data_; }
+
+
+void GeneratedPositionBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GeneratedPositionBatch*>(&to_msg);
+  auto& from = static_cast<const GeneratedPositionBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:PositionGenerator.GeneratedPositionBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.sensorid_.MergeFrom(from._impl_.sensorid_);
+  _this->_impl_.timestamp_usec_.MergeFrom(from._impl_.timestamp_usec_);
+  _this->_impl_.x_.MergeFrom(from._impl_.x_);
+  _this->_impl_.y_.MergeFrom(from._impl_.y_);
+  _this->_impl_.z_.MergeFrom(from._impl_.z_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GeneratedPositionBatch::CopyFrom(const GeneratedPositionBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:PositionGenerator.GeneratedPositionBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GeneratedPositionBatch::IsInitialized() const {
+  return true;
+}
+
+void GeneratedPositionBatch::InternalSwap(GeneratedPositionBatch* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.sensorid_.InternalSwap(&other->_impl_.sensorid_);
+  _impl_.timestamp_usec_.InternalSwap(&other->_impl_.timestamp_usec_);
+  _impl_.x_.InternalSwap(&other->_impl_.x_);
+  _impl_.y_.InternalSwap(&other->_impl_.y_);
+  _impl_.z_.InternalSwap(&other->_impl_.z_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GeneratedPositionBatch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SensorPosition_2eproto_getter, &descriptor_table_SensorPosition_2eproto_once,
+      file_level_metadata_SensorPosition_2eproto[2]);
+}
+
+// ===================================================================
+
+class GeneratedPositionDelta::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GeneratedPositionDelta>()._impl_._has_bits_);
+  static void set_has_keyframe(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_resolution(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_timestamp_usec(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+GeneratedPositionDelta::GeneratedPositionDelta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:PositionGenerator.GeneratedPositionDelta)
+}
+GeneratedPositionDelta::GeneratedPositionDelta(const GeneratedPositionDelta& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GeneratedPositionDelta* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sensorid_delta_){from._impl_.sensorid_delta_}
+    , /*decltype(_impl_._sensorid_delta_cached_byte_size_)*/{0}
+    , decltype(_impl_.timestamp_offset_){from._impl_.timestamp_offset_}
+    , /*decltype(_impl_._timestamp_offset_cached_byte_size_)*/{0}
+    , decltype(_impl_.x_){from._impl_.x_}
+    , /*decltype(_impl_._x_cached_byte_size_)*/{0}
+    , decltype(_impl_.y_){from._impl_.y_}
+    , /*decltype(_impl_._y_cached_byte_size_)*/{0}
+    , decltype(_impl_.z_){from._impl_.z_}
+    , /*decltype(_impl_._z_cached_byte_size_)*/{0}
+    , decltype(_impl_.keyframe_){}
+    , decltype(_impl_.resolution_){}
+    , decltype(_impl_.timestamp_usec_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.keyframe_, &from._impl_.keyframe_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.timestamp_usec_) -
+    reinterpret_cast<char*>(&_impl_.keyframe_)) + sizeof(_impl_.timestamp_usec_));
+  // @@protoc_insertion_point(copy_constructor:PositionGenerator.GeneratedPositionDelta)
+}
+
+inline void GeneratedPositionDelta::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sensorid_delta_){arena}
+    , /*decltype(_impl_._sensorid_delta_cached_byte_size_)*/{0}
+    , decltype(_impl_.timestamp_offset_){arena}
+    , /*decltype(_impl_._timestamp_offset_cached_byte_size_)*/{0}
+    , decltype(_impl_.x_){arena}
+    , /*decltype(_impl_._x_cached_byte_size_)*/{0}
+    , decltype(_impl_.y_){arena}
+    , /*decltype(_impl_._y_cached_byte_size_)*/{0}
+    , decltype(_impl_.z_){arena}
+    , /*decltype(_impl_._z_cached_byte_size_)*/{0}
+    , decltype(_impl_.keyframe_){false}
+    , decltype(_impl_.resolution_){0}
+    , decltype(_impl_.timestamp_usec_){uint64_t{0u}}
+  };
+}
+
+GeneratedPositionDelta::~GeneratedPositionDelta() {
+  // @@protoc_insertion_point(destructor:PositionGenerator.GeneratedPositionDelta)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GeneratedPositionDelta::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.sensorid_delta_.~RepeatedField();
+  _impl_.timestamp_offset_.~RepeatedField();
+  _impl_.x_.~RepeatedField();
+  _impl_.y_.~RepeatedField();
+  _impl_.z_.~RepeatedField();
+}
+
+void GeneratedPositionDelta::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GeneratedPositionDelta::Clear() {
+// @@protoc_insertion_point(message_clear_start:PositionGenerator.GeneratedPositionDelta)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.sensorid_delta_.Clear();
+  _impl_.timestamp_offset_.Clear();
+  _impl_.x_.Clear();
+  _impl_.y_.Clear();
+  _impl_.z_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.keyframe_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.timestamp_usec_) -
+        reinterpret_cast<char*>(&_impl_.keyframe_)) + sizeof(_impl_.timestamp_usec_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GeneratedPositionDelta::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required bool keyframe = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_keyframe(&has_bits);
+          _impl_.keyframe_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required float resolution = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_resolution(&has_bits);
+          _impl_.resolution_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 timestamp_usec = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_timestamp_usec(&has_bits);
+          _impl_.timestamp_usec_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated sint64 sensorId_delta = 4 [packed = true];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt64Parser(_internal_mutable_sensorid_delta(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_sensorid_delta(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated sint64 timestamp_offset = 5 [packed = true];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt64Parser(_internal_mutable_timestamp_offset(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 40) {
+          _internal_add_timestamp_offset(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated sint32 x = 6 [packed = true];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt32Parser(_internal_mutable_x(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 48) {
+          _internal_add_x(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated sint32 y = 7 [packed = true];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt32Parser(_internal_mutable_y(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 56) {
+          _internal_add_y(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated sint32 z = 8 [packed = true];
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt32Parser(_internal_mutable_z(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 64) {
+          _internal_add_z(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GeneratedPositionDelta::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:PositionGenerator.GeneratedPositionDelta)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required bool keyframe = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_keyframe(), target);
+  }
+
+  // required float resolution = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_resolution(), target);
+  }
+
+  // required uint64 timestamp_usec = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_timestamp_usec(), target);
+  }
+
+  // repeated sint64 sensorId_delta = 4 [packed = true];
+  {
+    int byte_size = _impl_._sensorid_delta_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt64Packed(
+          4, _internal_sensorid_delta(), byte_size, target);
+    }
+  }
+
+  // repeated sint64 timestamp_offset = 5 [packed = true];
+  {
+    int byte_size = _impl_._timestamp_offset_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt64Packed(
+          5, _internal_timestamp_offset(), byte_size, target);
+    }
+  }
+
+  // repeated sint32 x = 6 [packed = true];
+  {
+    int byte_size = _impl_._x_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt32Packed(
+          6, _internal_x(), byte_size, target);
+    }
+  }
+
+  // repeated sint32 y = 7 [packed = true];
+  {
+    int byte_size = _impl_._y_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt32Packed(
+          7, _internal_y(), byte_size, target);
+    }
+  }
+
+  // repeated sint32 z = 8 [packed = true];
+  {
+    int byte_size = _impl_._z_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt32Packed(
+          8, _internal_z(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:PositionGenerator.GeneratedPositionDelta)
+  return target;
+}
+
+size_t GeneratedPositionDelta::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:PositionGenerator.GeneratedPositionDelta)
+  size_t total_size = 0;
+
+  if (_internal_has_keyframe()) {
+    // required bool keyframe = 1;
+    total_size += 1 + 1;
+  }
+
+  if (_internal_has_resolution()) {
+    // required float resolution = 2;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_timestamp_usec()) {
+    // required uint64 timestamp_usec = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_timestamp_usec());
+  }
+
+  return total_size;
+}
+size_t GeneratedPositionDelta::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:PositionGenerator.GeneratedPositionDelta)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required bool keyframe = 1;
+    total_size += 1 + 1;
+
+    // required float resolution = 2;
+    total_size += 1 + 4;
+
+    // required uint64 timestamp_usec = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_timestamp_usec());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated sint64 sensorId_delta = 4 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      SInt64Size(this->_impl_.sensorid_delta_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._sensorid_delta_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated sint64 timestamp_offset = 5 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      SInt64Size(this->_impl_.timestamp_offset_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._timestamp_offset_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated sint32 x = 6 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      SInt32Size(this->_impl_.x_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._x_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated sint32 y = 7 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      SInt32Size(this->_impl_.y_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._y_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated sint32 z = 8 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      SInt32Size(this->_impl_.z_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._z_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GeneratedPositionDelta::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GeneratedPositionDelta::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GeneratedPositionDelta::GetClassData() const { return &_class_data_; }
+
+
+void GeneratedPositionDelta::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GeneratedPositionDelta*>(&to_msg);
+  auto& from = static_cast<const GeneratedPositionDelta&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:PositionGenerator.GeneratedPositionDelta)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.sensorid_delta_.MergeFrom(from._impl_.sensorid_delta_);
+  _this->_impl_.timestamp_offset_.MergeFrom(from._impl_.timestamp_offset_);
+  _this->_impl_.x_.MergeFrom(from._impl_.x_);
+  _this->_impl_.y_.MergeFrom(from._impl_.y_);
+  _this->_impl_.z_.MergeFrom(from._impl_.z_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.keyframe_ = from._impl_.keyframe_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.resolution_ = from._impl_.resolution_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.timestamp_usec_ = from._impl_.timestamp_usec_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GeneratedPositionDelta::CopyFrom(const GeneratedPositionDelta& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:PositionGenerator.GeneratedPositionDelta)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GeneratedPositionDelta::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void GeneratedPositionDelta::InternalSwap(GeneratedPositionDelta* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.sensorid_delta_.InternalSwap(&other->_impl_.sensorid_delta_);
+  _impl_.timestamp_offset_.InternalSwap(&other->_impl_.timestamp_offset_);
+  _impl_.x_.InternalSwap(&other->_impl_.x_);
+  _impl_.y_.InternalSwap(&other->_impl_.y_);
+  _impl_.z_.InternalSwap(&other->_impl_.z_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GeneratedPositionDelta, _impl_.timestamp_usec_)
+      + sizeof(GeneratedPositionDelta::_impl_.timestamp_usec_)
+      - PROTOBUF_FIELD_OFFSET(GeneratedPositionDelta, _impl_.keyframe_)>(
+          reinterpret_cast<char*>(&_impl_.keyframe_),
+          reinterpret_cast<char*>(&other->_impl_.keyframe_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GeneratedPositionDelta::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SensorPosition_2eproto_getter, &descriptor_table_SensorPosition_2eproto_once,
+      file_level_metadata_SensorPosition_2eproto[3]);
+}
+
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace PositionGenerator
 PROTOBUF_NAMESPACE_OPEN
@@ -720,6 +1639,14 @@ template<> PROTOBUF_NOINLINE ::PositionGenerator::GeneratedPosition*
 Arena::CreateMaybeMessage< ::PositionGenerator::GeneratedPosition >(Arena* arena) {
   return Arena::CreateMessageInternal< ::PositionGenerator::GeneratedPosition >(arena);
 }
+template<> PROTOBUF_NOINLINE ::PositionGenerator::GeneratedPositionBatch*
+Arena::CreateMaybeMessage< ::PositionGenerator::GeneratedPositionBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::PositionGenerator::GeneratedPositionBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::PositionGenerator::GeneratedPositionDelta*
+Arena::CreateMaybeMessage< ::PositionGenerator::GeneratedPositionDelta >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::PositionGenerator::GeneratedPositionDelta >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
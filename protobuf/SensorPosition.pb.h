@@ -51,10 +51,18 @@ extern Data3dDefaultTypeInternal _Data3d_default_instance_;
 class GeneratedPosition;
 struct GeneratedPositionDefaultTypeInternal;
 extern GeneratedPositionDefaultTypeInternal _GeneratedPosition_default_instance_;
+class GeneratedPositionBatch;
+struct GeneratedPositionBatchDefaultTypeInternal;
+extern GeneratedPositionBatchDefaultTypeInternal _GeneratedPositionBatch_default_instance_;
+class GeneratedPositionDelta;
+struct GeneratedPositionDeltaDefaultTypeInternal;
+extern GeneratedPositionDeltaDefaultTypeInternal _GeneratedPositionDelta_default_instance_;
 }  // namespace PositionGenerator
 PROTOBUF_NAMESPACE_OPEN
 template<> ::PositionGenerator::Data3d* Arena::CreateMaybeMessage<::PositionGenerator::Data3d>(Arena*);
 template<> ::PositionGenerator::GeneratedPosition* Arena::CreateMaybeMessage<::PositionGenerator::GeneratedPosition>(Arena*);
+template<> ::PositionGenerator::GeneratedPositionBatch* Arena::CreateMaybeMessage<::PositionGenerator::GeneratedPositionBatch>(Arena*);
+template<> ::PositionGenerator::GeneratedPositionDelta* Arena::CreateMaybeMessage<::PositionGenerator::GeneratedPositionDelta>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace PositionGenerator {
 
@@ -449,6 +457,590 @@ class GeneratedPosition final :
   union { Impl_ _impl_; };
   friend struct ::TableStruct_SensorPosition_2eproto;
 };
+// -------------------------------------------------------------------
+
+class GeneratedPositionBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:PositionGenerator.GeneratedPositionBatch) */ {
+ public:
+  inline GeneratedPositionBatch() : GeneratedPositionBatch(nullptr) {}
+  ~GeneratedPositionBatch() override;
+  explicit PROTOBUF_CONSTEXPR GeneratedPositionBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GeneratedPositionBatch(const GeneratedPositionBatch& from);
+  GeneratedPositionBatch(GeneratedPositionBatch&& from) noexcept
+    : GeneratedPositionBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline GeneratedPositionBatch& operator=(const GeneratedPositionBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GeneratedPositionBatch& operator=(GeneratedPositionBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GeneratedPositionBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GeneratedPositionBatch* internal_default_instance() {
+    return reinterpret_cast<const GeneratedPositionBatch*>(
+               &_GeneratedPositionBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(GeneratedPositionBatch& a, GeneratedPositionBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GeneratedPositionBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GeneratedPositionBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GeneratedPositionBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GeneratedPositionBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GeneratedPositionBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GeneratedPositionBatch& from) {
+    GeneratedPositionBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GeneratedPositionBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "PositionGenerator.GeneratedPositionBatch";
+  }
+  protected:
+  explicit GeneratedPositionBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSensorIdFieldNumber = 1,
+    kTimestampUsecFieldNumber = 2,
+    kXFieldNumber = 3,
+    kYFieldNumber = 4,
+    kZFieldNumber = 5,
+  };
+  // repeated uint64 sensorId = 1 [packed = true];
+  int sensorid_size() const;
+  private:
+  int _internal_sensorid_size() const;
+  public:
+  void clear_sensorid();
+  private:
+  uint64_t _internal_sensorid(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_sensorid() const;
+  void _internal_add_sensorid(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_sensorid();
+  public:
+  uint64_t sensorid(int index) const;
+  void set_sensorid(int index, uint64_t value);
+  void add_sensorid(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      sensorid() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_sensorid();
+
+  // repeated uint64 timestamp_usec = 2 [packed = true];
+  int timestamp_usec_size() const;
+  private:
+  int _internal_timestamp_usec_size() const;
+  public:
+  void clear_timestamp_usec();
+  private:
+  uint64_t _internal_timestamp_usec(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_timestamp_usec() const;
+  void _internal_add_timestamp_usec(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_timestamp_usec();
+  public:
+  uint64_t timestamp_usec(int index) const;
+  void set_timestamp_usec(int index, uint64_t value);
+  void add_timestamp_usec(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      timestamp_usec() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_timestamp_usec();
+
+  // repeated float x = 3 [packed = true];
+  int x_size() const;
+  private:
+  int _internal_x_size() const;
+  public:
+  void clear_x();
+  private:
+  float _internal_x(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_x() const;
+  void _internal_add_x(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_x();
+  public:
+  float x(int index) const;
+  void set_x(int index, float value);
+  void add_x(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      x() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_x();
+
+  // repeated float y = 4 [packed = true];
+  int y_size() const;
+  private:
+  int _internal_y_size() const;
+  public:
+  void clear_y();
+  private:
+  float _internal_y(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_y() const;
+  void _internal_add_y(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_y();
+  public:
+  float y(int index) const;
+  void set_y(int index, float value);
+  void add_y(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      y() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_y();
+
+  // repeated float z = 5 [packed = true];
+  int z_size() const;
+  private:
+  int _internal_z_size() const;
+  public:
+  void clear_z();
+  private:
+  float _internal_z(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_z() const;
+  void _internal_add_z(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_z();
+  public:
+  float z(int index) const;
+  void set_z(int index, float value);
+  void add_z(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      z() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_z();
+
+  // @@protoc_insertion_point(class_scope:PositionGenerator.GeneratedPositionBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > sensorid_;
+    mutable std::atomic<int> _sensorid_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > timestamp_usec_;
+    mutable std::atomic<int> _timestamp_usec_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > x_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > y_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > z_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SensorPosition_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GeneratedPositionDelta final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:PositionGenerator.GeneratedPositionDelta) */ {
+ public:
+  inline GeneratedPositionDelta() : GeneratedPositionDelta(nullptr) {}
+  ~GeneratedPositionDelta() override;
+  explicit PROTOBUF_CONSTEXPR GeneratedPositionDelta(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GeneratedPositionDelta(const GeneratedPositionDelta& from);
+  GeneratedPositionDelta(GeneratedPositionDelta&& from) noexcept
+    : GeneratedPositionDelta() {
+    *this = ::std::move(from);
+  }
+
+  inline GeneratedPositionDelta& operator=(const GeneratedPositionDelta& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GeneratedPositionDelta& operator=(GeneratedPositionDelta&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GeneratedPositionDelta& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GeneratedPositionDelta* internal_default_instance() {
+    return reinterpret_cast<const GeneratedPositionDelta*>(
+               &_GeneratedPositionDelta_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(GeneratedPositionDelta& a, GeneratedPositionDelta& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GeneratedPositionDelta* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GeneratedPositionDelta* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GeneratedPositionDelta* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GeneratedPositionDelta>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GeneratedPositionDelta& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GeneratedPositionDelta& from) {
+    GeneratedPositionDelta::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GeneratedPositionDelta* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "PositionGenerator.GeneratedPositionDelta";
+  }
+  protected:
+  explicit GeneratedPositionDelta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSensorIdDeltaFieldNumber = 4,
+    kTimestampOffsetFieldNumber = 5,
+    kXFieldNumber = 6,
+    kYFieldNumber = 7,
+    kZFieldNumber = 8,
+    kKeyframeFieldNumber = 1,
+    kResolutionFieldNumber = 2,
+    kTimestampUsecFieldNumber = 3,
+  };
+  // repeated sint64 sensorId_delta = 4 [packed = true];
+  int sensorid_delta_size() const;
+  private:
+  int _internal_sensorid_delta_size() const;
+  public:
+  void clear_sensorid_delta();
+  private:
+  int64_t _internal_sensorid_delta(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      _internal_sensorid_delta() const;
+  void _internal_add_sensorid_delta(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      _internal_mutable_sensorid_delta();
+  public:
+  int64_t sensorid_delta(int index) const;
+  void set_sensorid_delta(int index, int64_t value);
+  void add_sensorid_delta(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      sensorid_delta() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      mutable_sensorid_delta();
+
+  // repeated sint64 timestamp_offset = 5 [packed = true];
+  int timestamp_offset_size() const;
+  private:
+  int _internal_timestamp_offset_size() const;
+  public:
+  void clear_timestamp_offset();
+  private:
+  int64_t _internal_timestamp_offset(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      _internal_timestamp_offset() const;
+  void _internal_add_timestamp_offset(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      _internal_mutable_timestamp_offset();
+  public:
+  int64_t timestamp_offset(int index) const;
+  void set_timestamp_offset(int index, int64_t value);
+  void add_timestamp_offset(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      timestamp_offset() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      mutable_timestamp_offset();
+
+  // repeated sint32 x = 6 [packed = true];
+  int x_size() const;
+  private:
+  int _internal_x_size() const;
+  public:
+  void clear_x();
+  private:
+  int32_t _internal_x(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_x() const;
+  void _internal_add_x(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_x();
+  public:
+  int32_t x(int index) const;
+  void set_x(int index, int32_t value);
+  void add_x(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      x() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_x();
+
+  // repeated sint32 y = 7 [packed = true];
+  int y_size() const;
+  private:
+  int _internal_y_size() const;
+  public:
+  void clear_y();
+  private:
+  int32_t _internal_y(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_y() const;
+  void _internal_add_y(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_y();
+  public:
+  int32_t y(int index) const;
+  void set_y(int index, int32_t value);
+  void add_y(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      y() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_y();
+
+  // repeated sint32 z = 8 [packed = true];
+  int z_size() const;
+  private:
+  int _internal_z_size() const;
+  public:
+  void clear_z();
+  private:
+  int32_t _internal_z(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_z() const;
+  void _internal_add_z(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_z();
+  public:
+  int32_t z(int index) const;
+  void set_z(int index, int32_t value);
+  void add_z(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      z() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_z();
+
+  // required bool keyframe = 1;
+  bool has_keyframe() const;
+  private:
+  bool _internal_has_keyframe() const;
+  public:
+  void clear_keyframe();
+  bool keyframe() const;
+  void set_keyframe(bool value);
+  private:
+  bool _internal_keyframe() const;
+  void _internal_set_keyframe(bool value);
+  public:
+
+  // required float resolution = 2;
+  bool has_resolution() const;
+  private:
+  bool _internal_has_resolution() const;
+  public:
+  void clear_resolution();
+  float resolution() const;
+  void set_resolution(float value);
+  private:
+  float _internal_resolution() const;
+  void _internal_set_resolution(float value);
+  public:
+
+  // required uint64 timestamp_usec = 3;
+  bool has_timestamp_usec() const;
+  private:
+  bool _internal_has_timestamp_usec() const;
+  public:
+  void clear_timestamp_usec();
+  uint64_t timestamp_usec() const;
+  void set_timestamp_usec(uint64_t value);
+  private:
+  uint64_t _internal_timestamp_usec() const;
+  void _internal_set_timestamp_usec(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:PositionGenerator.GeneratedPositionDelta)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > sensorid_delta_;
+    mutable std::atomic<int> _sensorid_delta_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > timestamp_offset_;
+    mutable std::atomic<int> _timestamp_offset_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > x_;
+    mutable std::atomic<int> _x_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > y_;
+    mutable std::atomic<int> _y_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > z_;
+    mutable std::atomic<int> _z_cached_byte_size_;
+    bool keyframe_;
+    float resolution_;
+    uint64_t timestamp_usec_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SensorPosition_2eproto;
+};
 // ===================================================================
 
 
@@ -694,11 +1286,577 @@ inline void GeneratedPosition::set_allocated_position(::PositionGenerator::Data3
   // @@protoc_insertion_point(field_set_allocated:PositionGenerator.GeneratedPosition.position)
 }
 
+// -------------------------------------------------------------------
+
+// GeneratedPositionBatch
+
+// repeated uint64 sensorId = 1 [packed = true];
+inline int GeneratedPositionBatch::_internal_sensorid_size() const {
+  return _impl_.sensorid_.size();
+}
+inline int GeneratedPositionBatch::sensorid_size() const {
+  return _internal_sensorid_size();
+}
+inline void GeneratedPositionBatch::clear_sensorid() {
+  _impl_.sensorid_.Clear();
+}
+inline uint64_t GeneratedPositionBatch::_internal_sensorid(int index) const {
+  return _impl_.sensorid_.Get(index);
+}
+inline uint64_t GeneratedPositionBatch::sensorid(int index) const {
+  // @@protoc_insertion_point(field_get:PositionGenerator.GeneratedPositionBatch.sensorId)
+  return _internal_sensorid(index);
+}
+inline void GeneratedPositionBatch::set_sensorid(int index, uint64_t value) {
+  _impl_.sensorid_.Set(index, value);
+  // @@protoc_insertion_point(field_set:PositionGenerator.GeneratedPositionBatch.sensorId)
+}
+inline void GeneratedPositionBatch::_internal_add_sensorid(uint64_t value) {
+  _impl_.sensorid_.Add(value);
+}
+inline void GeneratedPositionBatch::add_sensorid(uint64_t value) {
+  _internal_add_sensorid(value);
+  // @@protoc_insertion_point(field_add:PositionGenerator.GeneratedPositionBatch.sensorId)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+GeneratedPositionBatch::_internal_sensorid() const {
+  return _impl_.sensorid_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+GeneratedPositionBatch::sensorid() const {
+  // @@protoc_insertion_point(field_list:PositionGenerator.GeneratedPositionBatch.sensorId)
+  return _internal_sensorid();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+GeneratedPositionBatch::_internal_mutable_sensorid() {
+  return &_impl_.sensorid_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+GeneratedPositionBatch::mutable_sensorid() {
+  // @@protoc_insertion_point(field_mutable_list:PositionGenerator.GeneratedPositionBatch.sensorId)
+  return _internal_mutable_sensorid();
+}
+
+// repeated uint64 timestamp_usec = 2 [packed = true];
+inline int GeneratedPositionBatch::_internal_timestamp_usec_size() const {
+  return _impl_.timestamp_usec_.size();
+}
+inline int GeneratedPositionBatch::timestamp_usec_size() const {
+  return _internal_timestamp_usec_size();
+}
+inline void GeneratedPositionBatch::clear_timestamp_usec() {
+  _impl_.timestamp_usec_.Clear();
+}
+inline uint64_t GeneratedPositionBatch::_internal_timestamp_usec(int index) const {
+  return _impl_.timestamp_usec_.Get(index);
+}
+inline uint64_t GeneratedPositionBatch::timestamp_usec(int index) const {
+  // @@protoc_insertion_point(field_get:PositionGenerator.GeneratedPositionBatch.timestamp_usec)
+  return _internal_timestamp_usec(index);
+}
+inline void GeneratedPositionBatch::set_timestamp_usec(int index, uint64_t value) {
+  _impl_.timestamp_usec_.Set(index, value);
+  // @@protoc_insertion_point(field_set:PositionGenerator.GeneratedPositionBatch.timestamp_usec)
+}
+inline void GeneratedPositionBatch::_internal_add_timestamp_usec(uint64_t value) {
+  _impl_.timestamp_usec_.Add(value);
+}
+inline void GeneratedPositionBatch::add_timestamp_usec(uint64_t value) {
+  _internal_add_timestamp_usec(value);
+  // @@protoc_insertion_point(field_add:PositionGenerator.GeneratedPositionBatch.timestamp_usec)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+GeneratedPositionBatch::_internal_timestamp_usec() const {
+  return _impl_.timestamp_usec_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+GeneratedPositionBatch::timestamp_usec() const {
+  // @@protoc_insertion_point(field_list:PositionGenerator.GeneratedPositionBatch.timestamp_usec)
+  return _internal_timestamp_usec();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+GeneratedPositionBatch::_internal_mutable_timestamp_usec() {
+  return &_impl_.timestamp_usec_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+GeneratedPositionBatch::mutable_timestamp_usec() {
+  // @@protoc_insertion_point(field_mutable_list:PositionGenerator.GeneratedPositionBatch.timestamp_usec)
+  return _internal_mutable_timestamp_usec();
+}
+
+// repeated float x = 3 [packed = true];
+inline int GeneratedPositionBatch::_internal_x_size() const {
+  return _impl_.x_.size();
+}
+inline int GeneratedPositionBatch::x_size() const {
+  return _internal_x_size();
+}
+inline void GeneratedPositionBatch::clear_x() {
+  _impl_.x_.Clear();
+}
+inline float GeneratedPositionBatch::_internal_x(int index) const {
+  return _impl_.x_.Get(index);
+}
+inline float GeneratedPositionBatch::x(int index) const {
+  // @@protoc_insertion_point(field_get:PositionGenerator.GeneratedPositionBatch.x)
+  return _internal_x(index);
+}
+inline void GeneratedPositionBatch::set_x(int index, float value) {
+  _impl_.x_.Set(index, value);
+  // @@protoc_insertion_point(field_set:PositionGenerator.GeneratedPositionBatch.x)
+}
+inline void GeneratedPositionBatch::_internal_add_x(float value) {
+  _impl_.x_.Add(value);
+}
+inline void GeneratedPositionBatch::add_x(float value) {
+  _internal_add_x(value);
+  // @@protoc_insertion_point(field_add:PositionGenerator.GeneratedPositionBatch.x)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+GeneratedPositionBatch::_internal_x() const {
+  return _impl_.x_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+GeneratedPositionBatch::x() const {
+  // @@protoc_insertion_point(field_list:PositionGenerator.GeneratedPositionBatch.x)
+  return _internal_x();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+GeneratedPositionBatch::_internal_mutable_x() {
+  return &_impl_.x_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+GeneratedPositionBatch::mutable_x() {
+  // @@protoc_insertion_point(field_mutable_list:PositionGenerator.GeneratedPositionBatch.x)
+  return _internal_mutable_x();
+}
+
+// repeated float y = 4 [packed = true];
+inline int GeneratedPositionBatch::_internal_y_size() const {
+  return _impl_.y_.size();
+}
+inline int GeneratedPositionBatch::y_size() const {
+  return _internal_y_size();
+}
+inline void GeneratedPositionBatch::clear_y() {
+  _impl_.y_.Clear();
+}
+inline float GeneratedPositionBatch::_internal_y(int index) const {
+  return _impl_.y_.Get(index);
+}
+inline float GeneratedPositionBatch::y(int index) const {
+  // @@protoc_insertion_point(field_get:PositionGenerator.GeneratedPositionBatch.y)
+  return _internal_y(index);
+}
+inline void GeneratedPositionBatch::set_y(int index, float value) {
+  _impl_.y_.Set(index, value);
+  // @@protoc_insertion_point(field_set:PositionGenerator.GeneratedPositionBatch.y)
+}
+inline void GeneratedPositionBatch::_internal_add_y(float value) {
+  _impl_.y_.Add(value);
+}
+inline void GeneratedPositionBatch::add_y(float value) {
+  _internal_add_y(value);
+  // @@protoc_insertion_point(field_add:PositionGenerator.GeneratedPositionBatch.y)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+GeneratedPositionBatch::_internal_y() const {
+  return _impl_.y_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+GeneratedPositionBatch::y() const {
+  // @@protoc_insertion_point(field_list:PositionGenerator.GeneratedPositionBatch.y)
+  return _internal_y();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+GeneratedPositionBatch::_internal_mutable_y() {
+  return &_impl_.y_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+GeneratedPositionBatch::mutable_y() {
+  // @@protoc_insertion_point(field_mutable_list:PositionGenerator.GeneratedPositionBatch.y)
+  return _internal_mutable_y();
+}
+
+// repeated float z = 5 [packed = true];
+inline int GeneratedPositionBatch::_internal_z_size() const {
+  return _impl_.z_.size();
+}
+inline int GeneratedPositionBatch::z_size() const {
+  return _internal_z_size();
+}
+inline void GeneratedPositionBatch::clear_z() {
+  _impl_.z_.Clear();
+}
+inline float GeneratedPositionBatch::_internal_z(int index) const {
+  return _impl_.z_.Get(index);
+}
+inline float GeneratedPositionBatch::z(int index) const {
+  // @@protoc_insertion_point(field_get:PositionGenerator.GeneratedPositionBatch.z)
+  return _internal_z(index);
+}
+inline void GeneratedPositionBatch::set_z(int index, float value) {
+  _impl_.z_.Set(index, value);
+  // @@protoc_insertion_point(field_set:PositionGenerator.GeneratedPositionBatch.z)
+}
+inline void GeneratedPositionBatch::_internal_add_z(float value) {
+  _impl_.z_.Add(value);
+}
+inline void GeneratedPositionBatch::add_z(float value) {
+  _internal_add_z(value);
+  // @@protoc_insertion_point(field_add:PositionGenerator.GeneratedPositionBatch.z)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+GeneratedPositionBatch::_internal_z() const {
+  return _impl_.z_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+GeneratedPositionBatch::z() const {
+  // @@protoc_insertion_point(field_list:PositionGenerator.GeneratedPositionBatch.z)
+  return _internal_z();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+GeneratedPositionBatch::_internal_mutable_z() {
+  return &_impl_.z_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+GeneratedPositionBatch::mutable_z() {
+  // @@protoc_insertion_point(field_mutable_list:PositionGenerator.GeneratedPositionBatch.z)
+  return _internal_mutable_z();
+}
+
+// -------------------------------------------------------------------
+
+// GeneratedPositionDelta
+
+// required bool keyframe = 1;
+inline bool GeneratedPositionDelta::_internal_has_keyframe() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool GeneratedPositionDelta::has_keyframe() const {
+  return _internal_has_keyframe();
+}
+inline void GeneratedPositionDelta::clear_keyframe() {
+  _impl_.keyframe_ = false;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline bool GeneratedPositionDelta::_internal_keyframe() const {
+  return _impl_.keyframe_;
+}
+inline bool GeneratedPositionDelta::keyframe() const {
+  // @@protoc_insertion_point(field_get:PositionGenerator.GeneratedPositionDelta.keyframe)
+  return _internal_keyframe();
+}
+inline void GeneratedPositionDelta::_internal_set_keyframe(bool value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.keyframe_ = value;
+}
+inline void GeneratedPositionDelta::set_keyframe(bool value) {
+  _internal_set_keyframe(value);
+  // @@protoc_insertion_point(field_set:PositionGenerator.GeneratedPositionDelta.keyframe)
+}
+
+// required float resolution = 2;
+inline bool GeneratedPositionDelta::_internal_has_resolution() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GeneratedPositionDelta::has_resolution() const {
+  return _internal_has_resolution();
+}
+inline void GeneratedPositionDelta::clear_resolution() {
+  _impl_.resolution_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline float GeneratedPositionDelta::_internal_resolution() const {
+  return _impl_.resolution_;
+}
+inline float GeneratedPositionDelta::resolution() const {
+  // @@protoc_insertion_point(field_get:PositionGenerator.GeneratedPositionDelta.resolution)
+  return _internal_resolution();
+}
+inline void GeneratedPositionDelta::_internal_set_resolution(float value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.resolution_ = value;
+}
+inline void GeneratedPositionDelta::set_resolution(float value) {
+  _internal_set_resolution(value);
+  // @@protoc_insertion_point(field_set:PositionGenerator.GeneratedPositionDelta.resolution)
+}
+
+// required uint64 timestamp_usec = 3;
+inline bool GeneratedPositionDelta::_internal_has_timestamp_usec() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool GeneratedPositionDelta::has_timestamp_usec() const {
+  return _internal_has_timestamp_usec();
+}
+inline void GeneratedPositionDelta::clear_timestamp_usec() {
+  _impl_.timestamp_usec_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t GeneratedPositionDelta::_internal_timestamp_usec() const {
+  return _impl_.timestamp_usec_;
+}
+inline uint64_t GeneratedPositionDelta::timestamp_usec() const {
+  // @@protoc_insertion_point(field_get:PositionGenerator.GeneratedPositionDelta.timestamp_usec)
+  return _internal_timestamp_usec();
+}
+inline void GeneratedPositionDelta::_internal_set_timestamp_usec(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.timestamp_usec_ = value;
+}
+inline void GeneratedPositionDelta::set_timestamp_usec(uint64_t value) {
+  _internal_set_timestamp_usec(value);
+  // @@protoc_insertion_point(field_set:PositionGenerator.GeneratedPositionDelta.timestamp_usec)
+}
+
+// repeated sint64 sensorId_delta = 4 [packed = true];
+inline int GeneratedPositionDelta::_internal_sensorid_delta_size() const {
+  return _impl_.sensorid_delta_.size();
+}
+inline int GeneratedPositionDelta::sensorid_delta_size() const {
+  return _internal_sensorid_delta_size();
+}
+inline void GeneratedPositionDelta::clear_sensorid_delta() {
+  _impl_.sensorid_delta_.Clear();
+}
+inline int64_t GeneratedPositionDelta::_internal_sensorid_delta(int index) const {
+  return _impl_.sensorid_delta_.Get(index);
+}
+inline int64_t GeneratedPositionDelta::sensorid_delta(int index) const {
+  // @@protoc_insertion_point(field_get:PositionGenerator.GeneratedPositionDelta.sensorId_delta)
+  return _internal_sensorid_delta(index);
+}
+inline void GeneratedPositionDelta::set_sensorid_delta(int index, int64_t value) {
+  _impl_.sensorid_delta_.Set(index, value);
+  // @@protoc_insertion_point(field_set:PositionGenerator.GeneratedPositionDelta.sensorId_delta)
+}
+inline void GeneratedPositionDelta::_internal_add_sensorid_delta(int64_t value) {
+  _impl_.sensorid_delta_.Add(value);
+}
+inline void GeneratedPositionDelta::add_sensorid_delta(int64_t value) {
+  _internal_add_sensorid_delta(value);
+  // @@protoc_insertion_point(field_add:PositionGenerator.GeneratedPositionDelta.sensorId_delta)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+GeneratedPositionDelta::_internal_sensorid_delta() const {
+  return _impl_.sensorid_delta_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+GeneratedPositionDelta::sensorid_delta() const {
+  // @@protoc_insertion_point(field_list:PositionGenerator.GeneratedPositionDelta.sensorId_delta)
+  return _internal_sensorid_delta();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+GeneratedPositionDelta::_internal_mutable_sensorid_delta() {
+  return &_impl_.sensorid_delta_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+GeneratedPositionDelta::mutable_sensorid_delta() {
+  // @@protoc_insertion_point(field_mutable_list:PositionGenerator.GeneratedPositionDelta.sensorId_delta)
+  return _internal_mutable_sensorid_delta();
+}
+
+// repeated sint64 timestamp_offset = 5 [packed = true];
+inline int GeneratedPositionDelta::_internal_timestamp_offset_size() const {
+  return _impl_.timestamp_offset_.size();
+}
+inline int GeneratedPositionDelta::timestamp_offset_size() const {
+  return _internal_timestamp_offset_size();
+}
+inline void GeneratedPositionDelta::clear_timestamp_offset() {
+  _impl_.timestamp_offset_.Clear();
+}
+inline int64_t GeneratedPositionDelta::_internal_timestamp_offset(int index) const {
+  return _impl_.timestamp_offset_.Get(index);
+}
+inline int64_t GeneratedPositionDelta::timestamp_offset(int index) const {
+  // @@protoc_insertion_point(field_get:PositionGenerator.GeneratedPositionDelta.timestamp_offset)
+  return _internal_timestamp_offset(index);
+}
+inline void GeneratedPositionDelta::set_timestamp_offset(int index, int64_t value) {
+  _impl_.timestamp_offset_.Set(index, value);
+  // @@protoc_insertion_point(field_set:PositionGenerator.GeneratedPositionDelta.timestamp_offset)
+}
+inline void GeneratedPositionDelta::_internal_add_timestamp_offset(int64_t value) {
+  _impl_.timestamp_offset_.Add(value);
+}
+inline void GeneratedPositionDelta::add_timestamp_offset(int64_t value) {
+  _internal_add_timestamp_offset(value);
+  // @@protoc_insertion_point(field_add:PositionGenerator.GeneratedPositionDelta.timestamp_offset)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+GeneratedPositionDelta::_internal_timestamp_offset() const {
+  return _impl_.timestamp_offset_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+GeneratedPositionDelta::timestamp_offset() const {
+  // @@protoc_insertion_point(field_list:PositionGenerator.GeneratedPositionDelta.timestamp_offset)
+  return _internal_timestamp_offset();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+GeneratedPositionDelta::_internal_mutable_timestamp_offset() {
+  return &_impl_.timestamp_offset_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+GeneratedPositionDelta::mutable_timestamp_offset() {
+  // @@protoc_insertion_point(field_mutable_list:PositionGenerator.GeneratedPositionDelta.timestamp_offset)
+  return _internal_mutable_timestamp_offset();
+}
+
+// repeated sint32 x = 6 [packed = true];
+inline int GeneratedPositionDelta::_internal_x_size() const {
+  return _impl_.x_.size();
+}
+inline int GeneratedPositionDelta::x_size() const {
+  return _internal_x_size();
+}
+inline void GeneratedPositionDelta::clear_x() {
+  _impl_.x_.Clear();
+}
+inline int32_t GeneratedPositionDelta::_internal_x(int index) const {
+  return _impl_.x_.Get(index);
+}
+inline int32_t GeneratedPositionDelta::x(int index) const {
+  // @@protoc_insertion_point(field_get:PositionGenerator.GeneratedPositionDelta.x)
+  return _internal_x(index);
+}
+inline void GeneratedPositionDelta::set_x(int index, int32_t value) {
+  _impl_.x_.Set(index, value);
+  // @@protoc_insertion_point(field_set:PositionGenerator.GeneratedPositionDelta.x)
+}
+inline void GeneratedPositionDelta::_internal_add_x(int32_t value) {
+  _impl_.x_.Add(value);
+}
+inline void GeneratedPositionDelta::add_x(int32_t value) {
+  _internal_add_x(value);
+  // @@protoc_insertion_point(field_add:PositionGenerator.GeneratedPositionDelta.x)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+GeneratedPositionDelta::_internal_x() const {
+  return _impl_.x_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+GeneratedPositionDelta::x() const {
+  // @@protoc_insertion_point(field_list:PositionGenerator.GeneratedPositionDelta.x)
+  return _internal_x();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+GeneratedPositionDelta::_internal_mutable_x() {
+  return &_impl_.x_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+GeneratedPositionDelta::mutable_x() {
+  // @@protoc_insertion_point(field_mutable_list:PositionGenerator.GeneratedPositionDelta.x)
+  return _internal_mutable_x();
+}
+
+// repeated sint32 y = 7 [packed = true];
+inline int GeneratedPositionDelta::_internal_y_size() const {
+  return _impl_.y_.size();
+}
+inline int GeneratedPositionDelta::y_size() const {
+  return _internal_y_size();
+}
+inline void GeneratedPositionDelta::clear_y() {
+  _impl_.y_.Clear();
+}
+inline int32_t GeneratedPositionDelta::_internal_y(int index) const {
+  return _impl_.y_.Get(index);
+}
+inline int32_t GeneratedPositionDelta::y(int index) const {
+  // @@protoc_insertion_point(field_get:PositionGenerator.GeneratedPositionDelta.y)
+  return _internal_y(index);
+}
+inline void GeneratedPositionDelta::set_y(int index, int32_t value) {
+  _impl_.y_.Set(index, value);
+  // @@protoc_insertion_point(field_set:PositionGenerator.GeneratedPositionDelta.y)
+}
+inline void GeneratedPositionDelta::_internal_add_y(int32_t value) {
+  _impl_.y_.Add(value);
+}
+inline void GeneratedPositionDelta::add_y(int32_t value) {
+  _internal_add_y(value);
+  // @@protoc_insertion_point(field_add:PositionGenerator.GeneratedPositionDelta.y)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+GeneratedPositionDelta::_internal_y() const {
+  return _impl_.y_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+GeneratedPositionDelta::y() const {
+  // @@protoc_insertion_point(field_list:PositionGenerator.GeneratedPositionDelta.y)
+  return _internal_y();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+GeneratedPositionDelta::_internal_mutable_y() {
+  return &_impl_.y_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+GeneratedPositionDelta::mutable_y() {
+  // @@protoc_insertion_point(field_mutable_list:PositionGenerator.GeneratedPositionDelta.y)
+  return _internal_mutable_y();
+}
+
+// repeated sint32 z = 8 [packed = true];
+inline int GeneratedPositionDelta::_internal_z_size() const {
+  return _impl_.z_.size();
+}
+inline int GeneratedPositionDelta::z_size() const {
+  return _internal_z_size();
+}
+inline void GeneratedPositionDelta::clear_z() {
+  _impl_.z_.Clear();
+}
+inline int32_t GeneratedPositionDelta::_internal_z(int index) const {
+  return _impl_.z_.Get(index);
+}
+inline int32_t GeneratedPositionDelta::z(int index) const {
+  // @@protoc_insertion_point(field_get:PositionGenerator.GeneratedPositionDelta.z)
+  return _internal_z(index);
+}
+inline void GeneratedPositionDelta::set_z(int index, int32_t value) {
+  _impl_.z_.Set(index, value);
+  // @@protoc_insertion_point(field_set:PositionGenerator.GeneratedPositionDelta.z)
+}
+inline void GeneratedPositionDelta::_internal_add_z(int32_t value) {
+  _impl_.z_.Add(value);
+}
+inline void GeneratedPositionDelta::add_z(int32_t value) {
+  _internal_add_z(value);
+  // @@protoc_insertion_point(field_add:PositionGenerator.GeneratedPositionDelta.z)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+GeneratedPositionDelta::_internal_z() const {
+  return _impl_.z_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+GeneratedPositionDelta::z() const {
+  // @@protoc_insertion_point(field_list:PositionGenerator.GeneratedPositionDelta.z)
+  return _internal_z();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+GeneratedPositionDelta::_internal_mutable_z() {
+  return &_impl_.z_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+GeneratedPositionDelta::mutable_z() {
+  // @@protoc_insertion_point(field_mutable_list:PositionGenerator.GeneratedPositionDelta.z)
+  return _internal_mutable_z();
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 